@@ -0,0 +1,79 @@
+/*
+ * callable_compile.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ *
+ * Compile time benchmark of is_callable and is_callable_object.
+ * 4000 instantiations over 1000 functor types: a half of the functors have
+ * a single call operator, the other half overloaded ones, every fourth of
+ * them is final. Built as C++17 the fallback traits are used, as C++20 the
+ * requires expressions.
+ */
+
+#include <pushkin/meta/callable.hpp>
+#include <pushkin/meta/function_traits.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+namespace psst {
+namespace meta {
+namespace bench {
+
+template < ::std::size_t N >
+struct single_functor {
+    int
+    operator() (int) const;
+};
+
+template < ::std::size_t N >
+struct overloaded_functor {
+    int
+    operator() (int) const;
+    int
+    operator() (int, long) const;
+};
+
+template < ::std::size_t N >
+struct final_functor final {
+    int
+    operator() (int, long) const;
+};
+
+template < ::std::size_t N >
+using functor = typename ::std::conditional<
+    N % 4 == 3,
+    final_functor<N>,
+    typename ::std::conditional<
+        N % 2 == 0,
+        single_functor<N>,
+        overloaded_functor<N> >::type >::type;
+
+template < typename T >
+constexpr int
+check()
+{
+    return is_callable<T, int>::value
+        + is_callable<T, int, long>::value
+        + is_callable<T const&, int>::value
+        + is_callable_object<T>::value;
+}
+
+template < ::std::size_t ... N >
+constexpr int
+check_all(::std::index_sequence<N...>)
+{
+    int sum = 0;
+    for (int v : { check< functor<N> >()... })
+        sum += v;
+    return sum;
+}
+
+constexpr int checked = check_all(::std::make_index_sequence<1000>{});
+static_assert(checked > 0, "");
+
+}  /* namespace bench */
+}  /* namespace meta */
+}  /* namespace psst */
@@ -0,0 +1,95 @@
+/*
+ * canonical_compile.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ *
+ * Compile time and code size benchmark of canonical type sets.
+ * A dispatch table is built for 16 orderings of the same 8 types, with
+ * BENCH_CANONICAL defined the type lists are canonicalized first and the
+ * table is instantiated once.
+ */
+
+#include <pushkin/meta/canonical.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+namespace psst {
+namespace meta {
+namespace bench {
+
+template < ::std::size_t N >
+struct message {
+    int value;
+};
+
+template < typename T >
+int
+handle(void const* msg)
+{
+    return static_cast<T const*>(msg)->value + static_cast<int>(sizeof(T));
+}
+
+template < typename Messages >
+struct dispatch_table;
+
+template < typename ... T >
+struct dispatch_table< type_tuple<T...> > {
+    using handler = int(*)(void const*);
+
+    static int
+    dispatch(::std::size_t index, void const* msg)
+    {
+        static constexpr handler handlers[]{ &handle<T>... };
+        return handlers[index](msg);
+    }
+};
+
+using messages = type_tuple< message<0>, message<1>, message<2>, message<3>,
+        message<4>, message<5>, message<6>, message<7> >;
+
+/**
+ * Ordering i -> (i * Step + Shift) % 8
+ */
+template < ::std::size_t Step, ::std::size_t Shift, typename Indexes >
+struct reorder;
+
+template < ::std::size_t Step, ::std::size_t Shift, ::std::size_t ... I >
+struct reorder< Step, Shift, ::std::index_sequence<I...> > {
+    using type = type_tuple< typename messages::template type<(I * Step + Shift) % 8>... >;
+};
+
+template < ::std::size_t Step, ::std::size_t Shift >
+using ordering = typename reorder< Step, Shift, ::std::make_index_sequence<8> >::type;
+
+#ifdef BENCH_CANONICAL
+template < typename T >
+using table_for = dispatch_table< canonical_t<T> >;
+#else
+template < typename T >
+using table_for = dispatch_table< T >;
+#endif
+
+template < ::std::size_t Step, ::std::size_t ... Shift >
+int
+dispatch_all(::std::size_t index, void const* msg, ::std::index_sequence<Shift...> const&)
+{
+    int res = 0;
+    (void)::std::initializer_list<int>{
+        (res += table_for< ordering<Step, Shift> >::dispatch(index, msg), 0)... };
+    return res;
+}
+
+int
+dispatch_orderings(::std::size_t index, void const* msg)
+{
+    auto shifts = ::std::make_index_sequence<4>{};
+    return dispatch_all<1>(index, msg, shifts) + dispatch_all<3>(index, msg, shifts)
+        + dispatch_all<5>(index, msg, shifts) + dispatch_all<7>(index, msg, shifts);
+}
+
+}  /* namespace bench */
+}  /* namespace meta */
+}  /* namespace psst */
@@ -0,0 +1,43 @@
+/*
+ * char_sequence_compile.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ *
+ * Compile time benchmark of building char sequences from strings.
+ * Compiled once per string length and per path, the build prints the
+ * time of each compilation.
+ *
+ * BENCH_LENGTH         length of the string, 16 to 4096
+ * BENCH_FIXED_STRING   use char_sequence_of<"..."> instead of
+ *                      make_char_sequence<Str>
+ */
+
+#include <pushkin/meta/char_sequence.hpp>
+
+#define BENCH_STR16     "0123456789abcdef"
+#define BENCH_STR64     BENCH_STR16 BENCH_STR16 BENCH_STR16 BENCH_STR16
+#define BENCH_STR256    BENCH_STR64 BENCH_STR64 BENCH_STR64 BENCH_STR64
+#define BENCH_STR1024   BENCH_STR256 BENCH_STR256 BENCH_STR256 BENCH_STR256
+#define BENCH_STR4096   BENCH_STR1024 BENCH_STR1024 BENCH_STR1024 BENCH_STR1024
+
+#define BENCH_CONCAT_(a, b) a ## b
+#define BENCH_CONCAT(a, b)  BENCH_CONCAT_(a, b)
+#define BENCH_STRING        BENCH_CONCAT(BENCH_STR, BENCH_LENGTH)
+
+namespace psst {
+namespace meta {
+namespace bench {
+
+#ifdef BENCH_FIXED_STRING
+using sequence = char_sequence_of< BENCH_STRING >;
+#else
+constexpr char bench_string[] = BENCH_STRING;
+using sequence = make_char_sequence< bench_string >;
+#endif
+
+static_assert(sequence::size::value == BENCH_LENGTH, "");
+
+}  /* namespace bench */
+}  /* namespace meta */
+}  /* namespace psst */
@@ -0,0 +1,122 @@
+/*
+ * function_bench.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#include <benchmark/benchmark.h>
+#include <pushkin/util/inplace_function.hpp>
+
+#include <array>
+#include <functional>
+
+namespace psst {
+namespace util {
+namespace bench {
+
+namespace {
+
+struct small_capture {
+    int* counter;
+
+    int
+    operator()(int v) const
+    { return *counter += v; }
+};
+
+struct large_capture {
+    ::std::array<int, 8> data;
+    int* counter;
+
+    int
+    operator()(int v) const
+    { return *counter += v + data[static_cast<::std::size_t>(v) % data.size()]; }
+};
+
+template < typename Callable >
+Callable
+make_callable(int* counter);
+
+template <>
+small_capture
+make_callable<small_capture>(int* counter)
+{ return small_capture{counter}; }
+
+template <>
+large_capture
+make_callable<large_capture>(int* counter)
+{ return large_capture{{{1, 2, 3, 4, 5, 6, 7, 8}}, counter}; }
+
+template < typename Callable >
+using inplace_for = inplace_function<int(int), sizeof(Callable)>;
+
+template < typename Wrapper, typename Callable >
+void
+construct(::benchmark::State& state)
+{
+    int counter = 0;
+    auto callable = make_callable<Callable>(&counter);
+    for (auto _ : state) {
+        Wrapper fn{callable};
+        ::benchmark::DoNotOptimize(fn);
+    }
+}
+
+template < typename Callable >
+void
+construct_function_ref(::benchmark::State& state)
+{
+    int counter = 0;
+    auto callable = make_callable<Callable>(&counter);
+    for (auto _ : state) {
+        function_ref<int(int)> fn{callable};
+        ::benchmark::DoNotOptimize(fn);
+    }
+}
+
+template < typename Wrapper, typename Callable >
+void
+call(::benchmark::State& state)
+{
+    int counter = 0;
+    auto callable = make_callable<Callable>(&counter);
+    Wrapper fn{callable};
+    ::benchmark::DoNotOptimize(fn);
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(fn(1));
+    }
+}
+
+template < typename Callable >
+void
+call_function_ref(::benchmark::State& state)
+{
+    int counter = 0;
+    auto callable = make_callable<Callable>(&counter);
+    function_ref<int(int)> fn{callable};
+    ::benchmark::DoNotOptimize(fn);
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(fn(1));
+    }
+}
+
+}  /* namespace */
+
+BENCHMARK_TEMPLATE(construct, ::std::function<int(int)>, small_capture);
+BENCHMARK_TEMPLATE(construct, ::std::function<int(int)>, large_capture);
+BENCHMARK_TEMPLATE(construct, inplace_for<small_capture>, small_capture);
+BENCHMARK_TEMPLATE(construct, inplace_for<large_capture>, large_capture);
+BENCHMARK_TEMPLATE(construct_function_ref, small_capture);
+BENCHMARK_TEMPLATE(construct_function_ref, large_capture);
+
+BENCHMARK_TEMPLATE(call, ::std::function<int(int)>, small_capture);
+BENCHMARK_TEMPLATE(call, ::std::function<int(int)>, large_capture);
+BENCHMARK_TEMPLATE(call, inplace_for<small_capture>, small_capture);
+BENCHMARK_TEMPLATE(call, inplace_for<large_capture>, large_capture);
+BENCHMARK_TEMPLATE(call_function_ref, small_capture);
+BENCHMARK_TEMPLATE(call_function_ref, large_capture);
+
+}  /* namespace bench */
+}  /* namespace util */
+}  /* namespace psst */
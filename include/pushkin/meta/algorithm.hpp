@@ -157,26 +157,24 @@ struct index_of_impl;
 template < typename T, ::std::size_t N, typename V, typename ... Y >
 struct index_of_impl< T, N, V, Y ... > : index_of_impl<T, N + 1, Y...> {};
 template < typename T, ::std::size_t N, typename ... Y >
-struct index_of_impl< T, N, T, Y ... > {
-    static constexpr ::std::size_t value    = N;
+struct index_of_impl< T, N, T, Y ... > : ::std::integral_constant<::std::size_t, N> {
     static constexpr bool found             = true;
 };
 
 template < typename T, ::std::size_t N >
-struct index_of_impl< T, N, T > {
-    static constexpr ::std::size_t value    = N;
+struct index_of_impl< T, N, T > : ::std::integral_constant<::std::size_t, N> {
     static constexpr bool found             = true;
 };
 
 template < typename T, ::std::size_t N, typename Y>
-struct index_of_impl<T, N, Y> {
-    static constexpr ::std::size_t value    = ::std::numeric_limits<::std::size_t>::max();
+struct index_of_impl<T, N, Y>
+    : ::std::integral_constant<::std::size_t, ::std::numeric_limits<::std::size_t>::max()> {
     static constexpr bool found             = false;
 };
 
 template < typename T, ::std::size_t N>
-struct index_of_impl<T, N> {
-    static constexpr ::std::size_t value    = ::std::numeric_limits<::std::size_t>::max();
+struct index_of_impl<T, N>
+    : ::std::integral_constant<::std::size_t, ::std::numeric_limits<::std::size_t>::max()> {
     static constexpr bool found             = false;
 };
 
@@ -189,6 +187,8 @@ struct index_of< T, type_tuple<Y...> > : detail::index_of_impl<T, 0, Y...> {};
 
 template < typename T, typename ... Y >
 using index_of_t = typename index_of<T, Y...>::type;
+template < typename T, typename ... Y >
+constexpr ::std::size_t index_of_v = index_of_t<T, Y...>::value;
 //@}
 
 //@{
@@ -467,6 +467,27 @@ struct unique< type_tuple<T...>, type_tuple<Y...> >
 template < typename ... T, typename ... Y >
 struct unique< unique<T...>, unique<Y...> >
     : unique<T..., Y...> {};
+
+namespace detail {
+
+template < typename Sequence, typename Indexes >
+struct unique_sequence;
+
+template < typename T, T ... Values, ::std::size_t ... I >
+struct unique_sequence< ::std::integer_sequence<T, Values...>, ::std::index_sequence<I...> > {
+    using type = ::std::integer_sequence<T, unique_values_of<T, Values...>::value.values[I]...>;
+};
+
+}  /* namespace detail */
+
+/**
+ * Integer sequence without repeated values, values are in the order of
+ * their first occurrence
+ */
+template < typename T, T ... Values >
+struct unique< ::std::integer_sequence<T, Values...> >
+    : detail::unique_sequence< ::std::integer_sequence<T, Values...>,
+        ::std::make_index_sequence< detail::unique_values_of<T, Values...>::value.count > > {};
 //@}
 
 template < typename T, typename ... Y >
@@ -9,12 +9,29 @@
 #define PUSHKIN_META_CALLABLE_HPP_
 
 #include <pushkin/meta/index_tuple.hpp>
+#include <cstdint>
 #include <tuple>
 #include <type_traits>
 
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
 namespace psst {
 namespace meta {
 
+#if __cplusplus >= 202002L
+/**
+ * A functor can be called with the arguments
+ */
+template < typename Functor, typename ... Args >
+concept callable_with = requires (Functor&& func, Args&& ... args) {
+    ::std::forward<Functor>(func)(::std::forward<Args>(args)...);
+};
+
+template < typename Functor, typename ... Args >
+struct is_callable : ::std::bool_constant< callable_with<Functor, Args...> > {};
+#else
 template <typename Functor, typename ... Args>
 struct is_callable {
 private:
@@ -25,7 +42,7 @@ private:
     template <typename U, ::std::size_t ... Indexes>
     static ::std::true_type
     test(indexes_tuple<Indexes...> const&,
-        decltype( ::std::declval<U>()( ::std::forward<Args>(::std::get<Indexes>(args))... ) ) const*);
+        decltype( ::std::declval<U>()( ::std::forward<Args>(::std::get<Indexes>(args))... ), void() )*);
     template <typename U>
     static ::std::false_type
     test(...);
@@ -33,14 +50,141 @@ public:
     static constexpr bool value = decltype( test<Functor>(indexes{}, nullptr) )::value;
 };
 
+#endif /* __cplusplus >= 202002L */
+
+namespace detail {
+
+/**
+ * Tag base for predicate combinators that can be evaluated without
+ * short-circuiting.
+ */
+struct predicate_combinator {};
+
+template < typename Predicate,
+        bool = ::std::is_base_of<predicate_combinator, Predicate>::value >
+struct fused_call {
+    template < typename T >
+    static bool
+    apply(T const& val)
+    {
+        return static_cast<bool>(Predicate{}(val));
+    }
+};
+
+template < typename Predicate >
+struct fused_call< Predicate, true > {
+    template < typename T >
+    static bool
+    apply(T const& val)
+    {
+        return Predicate::fused(val);
+    }
+};
+
+}  /* namespace detail */
+
+/**
+ * Batch evaluation of a predicate combinator over a contiguous range.
+ *
+ * The combinator is evaluated via its `fused` function, which evaluates
+ * all nested predicates with bitwise operations instead of branches, so
+ * the loops are candidates for auto-vectorization.
+ */
+template < typename Combinator >
+struct batch_predicate : detail::predicate_combinator {
+    static constexpr ::std::size_t mask_word_bits = 64;
+
+    /**
+     * Number of 64-bit words needed for a mask of n values
+     */
+    static constexpr ::std::size_t
+    mask_size(::std::size_t n)
+    {
+        return (n + mask_word_bits - 1) / mask_word_bits;
+    }
+
+    /**
+     * Evaluate the predicate for n values. Bit i of the mask is set if
+     * the predicate is true for data[i]. The mask must have room for
+     * mask_size(n) words, unused bits of the last word are cleared.
+     */
+    template < typename T >
+    static void
+    evaluate(T const* data, ::std::size_t n, ::std::uint64_t* mask)
+    {
+        ::std::size_t const full = n / mask_word_bits;
+        for (::std::size_t w = 0; w < full; ++w, data += mask_word_bits) {
+            ::std::uint64_t bits = 0;
+            for (::std::size_t i = 0; i < mask_word_bits; ++i) {
+                bits |= static_cast<::std::uint64_t>(Combinator::fused(data[i])) << i;
+            }
+            mask[w] = bits;
+        }
+        ::std::size_t const tail = n % mask_word_bits;
+        if (tail) {
+            ::std::uint64_t bits = 0;
+            for (::std::size_t i = 0; i < tail; ++i) {
+                bits |= static_cast<::std::uint64_t>(Combinator::fused(data[i])) << i;
+            }
+            mask[full] = bits;
+        }
+    }
+
+    /**
+     * Write indexes of values matching the predicate to out. The output
+     * must have room for n indexes.
+     * @return Number of matching values
+     */
+    template < typename T, typename Index >
+    static ::std::size_t
+    select(T const* data, ::std::size_t n, Index* out)
+    {
+        ::std::size_t count = 0;
+        for (::std::size_t i = 0; i < n; ++i) {
+            out[count] = static_cast<Index>(i);
+            count += Combinator::fused(data[i]);
+        }
+        return count;
+    }
+
+#if __cplusplus >= 202002L
+    /**
+     * Evaluate the predicate for a contiguous range, e.g. a span or
+     * a vector
+     */
+    template < ::std::ranges::contiguous_range Range >
+        requires ::std::ranges::sized_range<Range>
+    static void
+    evaluate(Range&& data, ::std::uint64_t* mask)
+    {
+        evaluate(::std::ranges::data(data), ::std::ranges::size(data), mask);
+    }
+
+    template < ::std::ranges::contiguous_range Range, typename Index >
+        requires ::std::ranges::sized_range<Range>
+    static ::std::size_t
+    select(Range&& data, Index* out)
+    {
+        return select(::std::ranges::data(data), ::std::ranges::size(data), out);
+    }
+#endif
+};
+
 template < typename Predicate >
-struct not_ {
+struct not_ : batch_predicate< not_<Predicate> > {
     template < typename ... Args >
     bool
     operator()(Args&& ... args) const
     {
         return !Predicate{}(::std::forward<Args>(args)...);
     }
+
+    template < typename T >
+    static bool
+    fused(T const& val)
+    {
+        return !detail::fused_call<Predicate>::apply(val);
+    }
 };
 
 template < typename ... Predicates >
@@ -49,7 +193,7 @@ template < typename ... Predicates >
 struct or_;
 
 template < typename Predicate, typename ... Rest >
-struct and_<Predicate, Rest...> {
+struct and_<Predicate, Rest...> : batch_predicate< and_<Predicate, Rest...> > {
     template < typename ... Args >
     bool
     operator()(Args&& ... args) const
@@ -57,57 +201,101 @@ struct and_<Predicate, Rest...> {
         return Predicate{}(::std::forward<Args>(args)...)
             && and_<Rest...>{}(::std::forward<Args>(args)...);
     }
+
+    template < typename T >
+    static bool
+    fused(T const& val)
+    {
+        return detail::fused_call<Predicate>::apply(val)
+            & and_<Rest...>::fused(val);
+    }
 };
 
 template < typename Predicate >
-struct and_<Predicate> {
+struct and_<Predicate> : batch_predicate< and_<Predicate> > {
     template < typename ... Args >
     bool
     operator()(Args&& ... args) const
     {
         return Predicate{}(::std::forward<Args>(args)...);
     }
+
+    template < typename T >
+    static bool
+    fused(T const& val)
+    {
+        return detail::fused_call<Predicate>::apply(val);
+    }
 };
 
 template <>
-struct and_<> {
+struct and_<> : batch_predicate< and_<> > {
     template < typename ... Args >
     bool
     operator()(Args&& ...) const
     {
         return false;
     }
+
+    template < typename T >
+    static bool
+    fused(T const&)
+    {
+        return false;
+    }
 };
 
 template < typename Predicate, typename ... Rest >
-struct or_<Predicate, Rest...> {
+struct or_<Predicate, Rest...> : batch_predicate< or_<Predicate, Rest...> > {
     template < typename ... Args >
     bool
     operator()(Args&& ... args) const
     {
         return Predicate{}(::std::forward<Args>(args)...)
-            || and_<Rest...>{}(::std::forward<Args>(args)...);
+            || or_<Rest...>{}(::std::forward<Args>(args)...);
+    }
+
+    template < typename T >
+    static bool
+    fused(T const& val)
+    {
+        return detail::fused_call<Predicate>::apply(val)
+            | or_<Rest...>::fused(val);
     }
 };
 
 template < typename Predicate >
-struct or_<Predicate> {
+struct or_<Predicate> : batch_predicate< or_<Predicate> > {
     template < typename ... Args >
     bool
     operator()(Args&& ... args) const
     {
         return Predicate{}(::std::forward<Args>(args)...);
     }
+
+    template < typename T >
+    static bool
+    fused(T const& val)
+    {
+        return detail::fused_call<Predicate>::apply(val);
+    }
 };
 
 template <>
-struct or_<> {
+struct or_<> : batch_predicate< or_<> > {
     template < typename ... Args >
     bool
     operator()(Args&& ...) const
     {
         return true;
     }
+
+    template < typename T >
+    static bool
+    fused(T const&)
+    {
+        return true;
+    }
 };
 
 }  /* namespace meta */
@@ -0,0 +1,187 @@
+/*
+ * canonical.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_META_CANONICAL_HPP_
+#define PUSHKIN_META_CANONICAL_HPP_
+
+#include <pushkin/meta/algorithm.hpp>
+#include <pushkin/meta/type_id.hpp>
+#include <pushkin/meta/type_map.hpp>
+
+#if __cplusplus >= 201703L
+
+namespace psst {
+namespace meta {
+
+//@{
+/**
+ * Order of types by type id, types with equal ids are ordered by name.
+ * The order is the same in all translation units.
+ */
+template < typename T, typename Y >
+struct type_id_less
+    : ::std::integral_constant< bool,
+        (type_id_v<T> < type_id_v<Y>)
+        || (type_id_v<T> == type_id_v<Y> && util::type_name<T>() < util::type_name<Y>()) > {};
+
+template < typename T, typename Y >
+constexpr bool type_id_less_v = type_id_less<T, Y>::value;
+//@}
+
+namespace detail {
+
+template < ::std::size_t N >
+struct type_id_order_type {
+    constexpr_array< ::std::size_t, N > positions;
+    ::std::size_t                       size;
+};
+
+/**
+ * Positions of unique types in the order of type_id_less. Types are
+ * sorted at once by a constexpr sort instead of a recursive merge sort of
+ * types, equal types are adjacent after sorting and are skipped.
+ */
+template < typename ... T >
+constexpr type_id_order_type< sizeof ... (T) >
+type_id_order() noexcept
+{
+    constexpr ::std::size_t size = sizeof ... (T);
+    ::std::uint64_t const ids[]{ type_id_v<T>..., 0 };
+    ::std::string_view const names[]{ util::type_name<T>()..., {} };
+    type_id_order_type<size> res{};
+    auto& pos = res.positions;
+    for (::std::size_t i = 0; i < size; ++i)
+        pos[i] = i;
+    // Insertion sort, type sets are short
+    for (::std::size_t i = 1; i < size; ++i) {
+        auto v = pos[i];
+        ::std::size_t j = i;
+        for (; j > 0 && (ids[v] < ids[pos[j - 1]]
+                || (ids[v] == ids[pos[j - 1]] && names[v] < names[pos[j - 1]])); --j)
+            pos[j] = pos[j - 1];
+        pos[j] = v;
+    }
+    for (::std::size_t i = 0; i < size; ++i) {
+        if (res.size == 0 || ids[pos[i]] != ids[pos[res.size - 1]]
+                || names[pos[i]] != names[pos[res.size - 1]])
+            pos[res.size++] = pos[i];
+    }
+    return res;
+}
+
+template < typename Types, typename Indexes = void >
+struct canonical_impl;
+
+template < typename ... T >
+struct canonical_impl< type_tuple<T...>, void > {
+    static constexpr auto order = type_id_order<T...>();
+    using type = typename canonical_impl< type_tuple<T...>,
+            ::std::make_index_sequence<order.size> >::type;
+};
+
+template < typename ... T, ::std::size_t ... I >
+struct canonical_impl< type_tuple<T...>, ::std::index_sequence<I...> > {
+    using type = type_tuple< typename type_tuple<T...>::template type<
+            canonical_impl< type_tuple<T...> >::order.positions[I] >... >;
+};
+
+}  /* namespace detail */
+
+//@{
+/**
+ * Metafunction to make a canonical form of a type set: unique types sorted
+ * by type id. Sets with the same types in any order or with duplicates have
+ * the same canonical form, so templates instantiated with it are
+ * instantiated once.
+ *
+ * Usage:
+ * @code
+ * static_assert(::std::is_same<
+ *         canonical_t<int, float, int>,
+ *         canonical_t<type_tuple<float, int>> >::value, "");
+ * @endcode
+ */
+template < typename ... T >
+struct canonical : detail::canonical_impl< type_tuple<T...> > {};
+
+template < typename ... T >
+struct canonical< type_tuple<T...> > : canonical<T...> {};
+
+template < typename ... T >
+using canonical_t = typename canonical<T...>::type;
+//@}
+
+//@{
+/**
+ * Metafunction to check if two type sets have the same types
+ */
+template < typename T, typename Y >
+struct same_set : ::std::is_same< canonical_t<T>, canonical_t<Y> > {};
+
+template < typename T, typename Y >
+constexpr bool same_set_v = same_set<T, Y>::value;
+//@}
+
+//@{
+/**
+ * Canonical forms of the results of set-like algorithms
+ */
+template < typename ... T >
+using canonical_unique_t    = canonical_t< unique_t<T...> >;
+template < typename ... T >
+using canonical_combine_t   = canonical_t< combine_t<T...> >;
+//@}
+
+namespace detail {
+
+template < typename T, typename Y >
+struct type_pair_key_less : type_id_less< typename T::key_type, typename Y::key_type > {};
+
+template < typename Pairs >
+struct unzip_type_pairs;
+
+template < typename ... P >
+struct unzip_type_pairs< type_tuple<P...> > {
+    using type = type_map< type_tuple< typename P::key_type... >,
+            type_tuple< typename P::value_type... > >;
+};
+
+template < typename Keys, typename Values >
+struct canonical_type_map_impl;
+
+template < typename ... K, typename ... V >
+struct canonical_type_map_impl< type_tuple<K...>, type_tuple<V...> > {
+    static_assert(sizeof ... (K) == sizeof ... (V), "Incorrect size of type_map");
+    using type = typename unzip_type_pairs<
+            stable_sort_t< type_pair_key_less, type_pair<K, V>... > >::type;
+};
+
+template <>
+struct canonical_type_map_impl< type_tuple<>, type_tuple<> > {
+    using type = type_map<>;
+};
+
+}  /* namespace detail */
+
+//@{
+/**
+ * Metafunction to make a type_map with keys sorted by type id, maps with
+ * the same key-value pairs in any order have the same type
+ */
+template < typename Keys, typename Values >
+struct canonical_type_map : detail::canonical_type_map_impl<Keys, Values> {};
+
+template < typename Keys, typename Values >
+using canonical_type_map_t = typename canonical_type_map<Keys, Values>::type;
+//@}
+
+}  /* namespace meta */
+}  /* namespace psst */
+
+#endif /* __cplusplus >= 201703L */
+
+#endif /* PUSHKIN_META_CANONICAL_HPP_ */
@@ -23,11 +23,13 @@ struct first_char {
     using type = ::std::integral_constant<char, C>;
 };
 
+/**
+ * Not recursive, so that long sequences don't hit the instantiation depth
+ */
 template < char C, char ... Chars >
-struct last_char : last_char< Chars ... > {};
-template < char C >
-struct last_char<C> {
-    using type = ::std::integral_constant<char, C>;
+struct last_char {
+    using type = ::std::integral_constant<char,
+            sequence_value(::std::integer_sequence<char, C, Chars...>{}, sizeof ... (Chars))>;
 };
 
 constexpr ::std::size_t
@@ -499,6 +501,91 @@ using make_char_literal_s = typename detail::make_char_literal_impl<Str,
 
 #endif /* __cplusplus >= 201402L */
 
+#if __cplusplus >= 202002L
+/**
+ * A string that can be used as a template parameter
+ */
+template < ::std::size_t N >
+struct fixed_string {
+    char value[N];
+
+    constexpr fixed_string(char const (&str)[N]) noexcept
+        : value{}
+    {
+        for (::std::size_t i = 0; i < N; ++i)
+            value[i] = str[i];
+    }
+
+    static constexpr ::std::size_t
+    size() noexcept
+    { return N - 1; }
+};
+
+template < ::std::size_t N >
+fixed_string(char const (&)[N]) -> fixed_string<N>;
+
+namespace detail {
+
+template < fixed_string Str, typename Indexes = ::std::make_index_sequence<Str.size()> >
+struct fixed_string_chars;
+
+template < fixed_string Str, ::std::size_t ... Indexes >
+struct fixed_string_chars< Str, ::std::index_sequence<Indexes...> > {
+    using sequence  = char_sequence< Str.value[Indexes]... >;
+    using literal   = char_sequence_literal< Str.value[Indexes]... >;
+};
+
+} /* namespace detail */
+
+/**
+ * Make a char sequence from a string literal, compile-time
+ *
+ * Usage:
+ * @code
+ * using hello = char_sequence_of<"hello">;
+ * @endcode
+ */
+template < fixed_string Str >
+using char_sequence_of = typename detail::fixed_string_chars<Str>::sequence;
+
+template < fixed_string Str >
+using char_literal_of = typename detail::fixed_string_chars<Str>::literal;
+#endif /* __cplusplus >= 202002L */
+
+namespace literals {
+
+/**
+ * Numeric literal to char_sequence, the characters of the literal are
+ * kept as written, including base prefixes, digit separators and exponent.
+ *
+ * Usage:
+ * @code
+ * using namespace ::psst::meta::literals;
+ * using hex = decltype(0x1F_cs); // char_sequence<'0', 'x', '1', 'F'>
+ * @endcode
+ */
+template < char ... Chars >
+constexpr char_sequence<Chars...>
+operator""_cs() noexcept
+{ return {}; }
+
+#if __cplusplus >= 202002L
+/**
+ * String literal to char_sequence
+ *
+ * Usage:
+ * @code
+ * using hello = decltype("hello"_cs);
+ * @endcode
+ */
+template < fixed_string Str >
+constexpr char_sequence_of<Str>
+operator""_cs() noexcept
+{ return {}; }
+#endif /* __cplusplus >= 202002L */
+
+} /* namespace literals */
+
 } /* namespace meta */
 } /* namespace psst */
 
@@ -8,16 +8,23 @@
 #ifndef PSST_META_FUNCTION_TRAITS_HPP_
 #define PSST_META_FUNCTION_TRAITS_HPP_
 
+#include <cstddef>
 #include <tuple>
+#include <type_traits>
 #include <pushkin/meta/index_tuple.hpp>
+#include <pushkin/meta/type_tuple.hpp>
 
 namespace psst {
 namespace meta {
 
 namespace detail {
 
+/**
+ * Detects an overloaded or a template call operator, the class is derived
+ * from, so it must not be final
+ */
 template <typename T>
-struct has_call_operator {
+struct has_any_call_operator {
 private:
     struct _fallback { void operator()(); };
     struct _derived : T, _fallback {};
@@ -36,6 +43,42 @@ public:
             ::std::is_same< decltype(test<_derived>(0)), ::std::true_type >::value;
 };
 
+#if __cplusplus >= 202002L
+template < typename T >
+concept has_single_call_operator = requires { &T::operator(); };
+
+/**
+ * A single call operator is checked first, the derivation is needed only
+ * for overloaded or template call operators of non-final classes.
+ */
+template < typename T >
+struct has_call_operator
+    : ::std::disjunction<
+        ::std::bool_constant< has_single_call_operator<T> >,
+        ::std::conditional_t< ::std::is_final<T>::value,
+            ::std::false_type, has_any_call_operator<T> > > {};
+#else
+template < typename T >
+struct has_single_call_operator {
+private:
+    template < typename C >
+    static ::std::true_type test(decltype(&C::operator())*);
+    template < typename >
+    static ::std::false_type test(...);
+public:
+    static constexpr bool value = decltype(test<T>(nullptr))::value;
+};
+
+/**
+ * Final classes cannot be derived from, only a single call operator is
+ * detected for them
+ */
+template < typename T >
+struct has_call_operator
+    : ::std::conditional< ::std::is_final<T>::value,
+        has_single_call_operator<T>, has_any_call_operator<T> >::type {};
+#endif /* __cplusplus >= 202002L */
+
 }  // namespace detail
 
 template < typename T >
@@ -57,130 +100,137 @@ struct not_a_function {
 };
 
 /**
- * function_traits for a function pointer with argument count > 1
- */
-template < typename Return, typename ... Args >
-struct function_traits< Return(*)(Args...) > {
-    enum { arity = sizeof...(Args) };
-
-    using result_type               = Return;
-    using args_tuple_type           = ::std::tuple< Args ... >;
-    using decayed_args_tuple_type   = ::std::tuple< typename ::std::decay<Args>::type ... >;
-    template < size_t n>
-    struct arg {
-        using type                  = typename ::std::tuple_element<n, args_tuple_type>::type;
-    };
-};
-
-/**
- * function_traits for a function pointer with argument count == 1
+ * Reference qualifier of a member function
  */
-template < typename Return, typename Arg >
-struct function_traits< Return(*)(Arg) > {
-    enum { arity = 1 };
-
-    using result_type = Return;
-    using args_tuple_type = Arg;
-    using decayed_args_tuple_type   = typename ::std::decay<Arg>::type;
+enum class ref_qualifier {
+    none,
+    lvalue,
+    rvalue
 };
 
-/**
- * function_traits for a function pointer with argument count == 0
- */
-template < typename Return >
-struct function_traits< Return(*)() > {
-    enum { arity = 0 };
-    using result_type               = Return;
-    using args_tuple_type           = void;
-    using decayed_args_tuple_type   = void;
-};
+namespace detail {
 
 /**
- * function_traits for a class member const function with argument count > 1
+ * Return and argument types of a function with argument count > 1
  */
-template < typename Class, typename Return, typename ... Args >
-struct function_traits< Return(Class::*)(Args...) const> {
+template < typename Return, typename ... Args >
+struct function_traits_base {
     enum { arity = sizeof...(Args) };
 
-    using class_type                = Class;
     using result_type               = Return;
     using args_tuple_type           = ::std::tuple< Args ... >;
     using decayed_args_tuple_type   = ::std::tuple< typename ::std::decay<Args>::type ... >;
-
-    template < size_t n>
+    template < ::std::size_t n>
     struct arg {
         using type                  = typename ::std::tuple_element<n, args_tuple_type>::type;
     };
 };
 
 /**
- * function_traits for a class member const function with argument count == 1
+ * Return and argument types of a function with argument count == 1
  */
-template < typename Class, typename Return, typename Arg >
-struct function_traits< Return(Class::*)(Arg) const > {
+template < typename Return, typename Arg >
+struct function_traits_base< Return, Arg > {
     enum { arity = 1 };
 
-    using class_type                = Class;
-    using result_type = Return;
-    using args_tuple_type = Arg;
+    using result_type               = Return;
+    using args_tuple_type           = Arg;
     using decayed_args_tuple_type   = typename ::std::decay<Arg>::type;
 };
 
 /**
- * function_traits for a class member const function with argument count == 0
+ * Return and argument types of a function with argument count == 0
  */
-template < typename Class, typename Return >
-struct function_traits< Return(Class::*)() const> {
+template < typename Return >
+struct function_traits_base< Return > {
     enum { arity = 0 };
 
-    using class_type                = Class;
     using result_type               = Return;
     using args_tuple_type           = void;
     using decayed_args_tuple_type   = void;
 };
 
 /**
- * function_traits for a class member non-const function with argument count > 1
+ * Qualifiers of a function. A C variadic function (with an ellipsis)
+ * has is_variadic set, the arity doesn't count the ellipsis.
  */
-template < typename Class, typename Return, typename ... Args >
-struct function_traits< Return(Class::*)(Args...) > {
-    enum { arity = sizeof...(Args) };
+template < bool Noexcept, bool Variadic >
+struct function_qualifiers {
+    static constexpr bool is_noexcept   = Noexcept;
+    static constexpr bool is_variadic   = Variadic;
+};
 
-    using class_type                = Class;
-    using result_type               = Return;
-    using args_tuple_type           = ::std::tuple< Args ... >;
-    using decayed_args_tuple_type   = ::std::tuple< typename ::std::decay<Args>::type ... >;
-    template < size_t n>
-    struct arg {
-        using type                  = typename ::std::tuple_element<n, args_tuple_type>::type;
-    };
+template < typename Class, bool Const, bool Volatile, ref_qualifier Ref >
+struct member_function_qualifiers {
+    using class_type                    = Class;
+    static constexpr bool is_const      = Const;
+    static constexpr bool is_volatile   = Volatile;
+    static constexpr ref_qualifier ref  = Ref;
 };
 
+}  // namespace detail
+
 /**
- * function_traits for a class member non-const function with argument count == 1
+ * function_traits for free functions and function pointers
  */
-template < typename Class, typename Return, typename Arg >
-struct function_traits< Return(Class::*)(Arg) > {
-    enum { arity = 1 };
-
-    using class_type                = Class;
-    using result_type = Return;
-    using args_tuple_type = Arg;
-    using decayed_args_tuple_type   = typename ::std::decay<Arg>::type;
-};
+#define PSST_META_FUNCTION_TRAITS(NOEXCEPT, IS_NOEXCEPT)                       \
+template < typename Return, typename ... Args >                                 \
+struct function_traits< Return(Args...) NOEXCEPT >                              \
+    : detail::function_traits_base< Return, Args... >,                         \
+      detail::function_qualifiers< IS_NOEXCEPT, false > {};                    \
+template < typename Return, typename ... Args >                                 \
+struct function_traits< Return(Args..., ...) NOEXCEPT >                         \
+    : detail::function_traits_base< Return, Args... >,                         \
+      detail::function_qualifiers< IS_NOEXCEPT, true > {};                     \
+template < typename Return, typename ... Args >                                 \
+struct function_traits< Return(*)(Args...) NOEXCEPT >                           \
+    : function_traits< Return(Args...) NOEXCEPT > {};                           \
+template < typename Return, typename ... Args >                                 \
+struct function_traits< Return(*)(Args..., ...) NOEXCEPT >                      \
+    : function_traits< Return(Args..., ...) NOEXCEPT > {};
 
 /**
- * function_traits for a class member non-const function with argument count == 0
+ * function_traits for member function pointers with all combinations of
+ * cv and reference qualifiers
  */
-template < typename Class, typename Return >
-struct function_traits< Return(Class::*)() > {
-    enum { arity = 0 };
-
-    using class_type                = Class;
-    using result_type               = Return;
-    using args_tuple_type           = void;
-    using decayed_args_tuple_type   = void;
-};
+#define PSST_META_MEMBER_FUNCTION_TRAITS(CV, IS_CONST, IS_VOLATILE, REF, REF_KIND, \
+        NOEXCEPT, IS_NOEXCEPT)                                                  \
+template < typename Class, typename Return, typename ... Args >                 \
+struct function_traits< Return(Class::*)(Args...) CV REF NOEXCEPT >             \
+    : detail::function_traits_base< Return, Args... >,                         \
+      detail::member_function_qualifiers< Class, IS_CONST, IS_VOLATILE,        \
+            ref_qualifier::REF_KIND >,                                          \
+      detail::function_qualifiers< IS_NOEXCEPT, false > {};                    \
+template < typename Class, typename Return, typename ... Args >                 \
+struct function_traits< Return(Class::*)(Args..., ...) CV REF NOEXCEPT >        \
+    : detail::function_traits_base< Return, Args... >,                         \
+      detail::member_function_qualifiers< Class, IS_CONST, IS_VOLATILE,        \
+            ref_qualifier::REF_KIND >,                                          \
+      detail::function_qualifiers< IS_NOEXCEPT, true > {};
+
+#define PSST_META_MEMBER_FUNCTION_TRAITS_CV(REF, REF_KIND, NOEXCEPT, IS_NOEXCEPT) \
+PSST_META_MEMBER_FUNCTION_TRAITS(, false, false, REF, REF_KIND, NOEXCEPT, IS_NOEXCEPT) \
+PSST_META_MEMBER_FUNCTION_TRAITS(const, true, false, REF, REF_KIND, NOEXCEPT, IS_NOEXCEPT) \
+PSST_META_MEMBER_FUNCTION_TRAITS(volatile, false, true, REF, REF_KIND, NOEXCEPT, IS_NOEXCEPT) \
+PSST_META_MEMBER_FUNCTION_TRAITS(const volatile, true, true, REF, REF_KIND, NOEXCEPT, IS_NOEXCEPT)
+
+#define PSST_META_MEMBER_FUNCTION_TRAITS_REF(NOEXCEPT, IS_NOEXCEPT)            \
+PSST_META_MEMBER_FUNCTION_TRAITS_CV(, none, NOEXCEPT, IS_NOEXCEPT)              \
+PSST_META_MEMBER_FUNCTION_TRAITS_CV(&, lvalue, NOEXCEPT, IS_NOEXCEPT)           \
+PSST_META_MEMBER_FUNCTION_TRAITS_CV(&&, rvalue, NOEXCEPT, IS_NOEXCEPT)
+
+PSST_META_FUNCTION_TRAITS(, false)
+PSST_META_MEMBER_FUNCTION_TRAITS_REF(, false)
+// noexcept is a part of the function type since C++17
+#if __cpp_noexcept_function_type >= 201510L
+PSST_META_FUNCTION_TRAITS(noexcept, true)
+PSST_META_MEMBER_FUNCTION_TRAITS_REF(noexcept, true)
+#endif
+
+#undef PSST_META_MEMBER_FUNCTION_TRAITS_REF
+#undef PSST_META_MEMBER_FUNCTION_TRAITS_CV
+#undef PSST_META_MEMBER_FUNCTION_TRAITS
+#undef PSST_META_FUNCTION_TRAITS
 
 template < typename T >
 struct call_operator_traits : function_traits< decltype(&T::operator()) > {};
@@ -202,53 +252,133 @@ struct is_func_void :
 
 namespace detail {
 
-template < typename Func, size_t ... Indexes, typename ... T >
-typename function_traits<Func>::result_type
-invoke(Func func, indexes_tuple< Indexes ... >, ::std::tuple< T ... >& args)
-{
-    return func(::std::get<Indexes>(args) ...);
-}
+template < typename T, int Arity >
+struct args_type_tuple {
+    using type = type_tuple< T >;
+};
 
-template < typename Func, size_t ... Indexes, typename ... T >
-typename function_traits<Func>::result_type
-invoke(Func func, indexes_tuple< Indexes ... >, ::std::tuple< T ... >&& args)
+template < typename T >
+struct args_type_tuple< T, 0 > {
+    using type = type_tuple<>;
+};
+
+template < typename ... T, int Arity >
+struct args_type_tuple< ::std::tuple< T ... >, Arity > {
+    using type = type_tuple< T ... >;
+};
+
+template < typename ... T >
+struct args_type_tuple< ::std::tuple< T ... >, 1 > {
+    using type = type_tuple< ::std::tuple< T ... > >;
+};
+
+}  // namespace detail
+
+/**
+ * Metafunction to get argument types of a function as a type_tuple,
+ * regardless of the argument count.
+ */
+template < typename Func >
+struct function_args
+    : detail::args_type_tuple<
+        typename function_traits< Func >::args_tuple_type,
+        function_traits< Func >::arity > {};
+template < typename Func >
+using function_args_t = typename function_args< Func >::type;
+
+namespace detail {
+
+template < typename Return, typename Args >
+struct make_signature;
+
+template < typename Return, typename ... Args >
+struct make_signature< Return, type_tuple< Args ... > > {
+    using type = Return(Args ...);
+};
+
+}  // namespace detail
+
+/**
+ * Metafunction to get a function type, e.g. `int(double)`, for a function
+ * pointer, member function pointer or a callable object.
+ * For member functions the class type is not included.
+ */
+template < typename Func >
+struct function_signature
+    : detail::make_signature<
+        typename function_traits< Func >::result_type,
+        function_args_t< Func > > {};
+template < typename Func >
+using function_signature_t = typename function_signature< Func >::type;
+
+namespace detail {
+
+template < typename Func, typename Tuple, ::std::size_t ... Indexes >
+constexpr decltype(auto)
+apply(Func&& func, Tuple&& args, ::std::index_sequence< Indexes ... > const&)
+    noexcept(noexcept(::std::forward<Func>(func)(
+            ::std::get<Indexes>(::std::forward<Tuple>(args)) ...)))
 {
-    return func(::std::move(::std::get<Indexes>(args)) ...);
+    return ::std::forward<Func>(func)(::std::get<Indexes>(::std::forward<Tuple>(args)) ...);
 }
 
+}  // namespace detail
 
-template < typename Func, size_t ... Indexes, typename ... T >
-typename function_traits<Func>::result_type
-invoke(Func func, indexes_tuple< Indexes ... >, T&& ... args)
+/**
+ * Call a function with the arguments, the function and the arguments are
+ * perfectly forwarded and the call is noexcept if the function is.
+ */
+template < typename Func, typename ... T >
+constexpr decltype(auto)
+invoke(Func&& func, T&& ... args)
+    noexcept(noexcept(::std::forward<Func>(func)(::std::forward<T>(args) ...)))
 {
-    return func(::std::forward<T>(args) ... );
+    return ::std::forward<Func>(func)(::std::forward<T>(args) ...);
 }
 
-}  // namespace detail
+/**
+ * Call a function with elements of a tuple-like object as arguments,
+ * elements of an rvalue tuple are moved
+ */
+template < typename Func, typename Tuple >
+constexpr decltype(auto)
+apply(Func&& func, Tuple&& args)
+    noexcept(noexcept(detail::apply(::std::forward<Func>(func), ::std::forward<Tuple>(args),
+            ::std::make_index_sequence<
+                ::std::tuple_size< ::std::decay_t<Tuple> >::value >{})))
+{
+    return detail::apply(::std::forward<Func>(func), ::std::forward<Tuple>(args),
+            ::std::make_index_sequence< ::std::tuple_size< ::std::decay_t<Tuple> >::value >{});
+}
 
+//@{
+/**
+ * Call a function with elements of a tuple as arguments, same as apply
+ */
 template < typename Func, typename ... T >
-typename function_traits<Func>::result_type
-invoke(Func func, ::std::tuple< T ... >& args)
+constexpr decltype(auto)
+invoke(Func&& func, ::std::tuple< T ... >& args)
+    noexcept(noexcept(meta::apply(::std::forward<Func>(func), args)))
 {
-    using index_type = typename index_builder< sizeof ... (T) >::type;
-    return detail::invoke(func, index_type(), args);
+    return meta::apply(::std::forward<Func>(func), args);
 }
 
 template < typename Func, typename ... T >
-typename function_traits<Func>::result_type
-invoke(Func func, ::std::tuple< T ... >&& args)
+constexpr decltype(auto)
+invoke(Func&& func, ::std::tuple< T ... > const& args)
+    noexcept(noexcept(meta::apply(::std::forward<Func>(func), args)))
 {
-    using index_type = typename index_builder< sizeof ... (T) >::type;
-    return detail::invoke(func, index_type(), ::std::move(args));
+    return meta::apply(::std::forward<Func>(func), args);
 }
 
 template < typename Func, typename ... T >
-typename function_traits<Func>::result_type
-invoke(Func func, T&& ... args)
+constexpr decltype(auto)
+invoke(Func&& func, ::std::tuple< T ... >&& args)
+    noexcept(noexcept(meta::apply(::std::forward<Func>(func), ::std::move(args))))
 {
-    using index_type = typename index_builder< sizeof ... (T)>::type;
-    return detail::invoke(func, index_type{}, ::std::forward<T>(args) ...);
+    return meta::apply(::std::forward<Func>(func), ::std::move(args));
 }
+//@}
 
 }  // namespace meta
 }  // namespace psst
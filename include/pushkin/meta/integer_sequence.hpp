@@ -8,6 +8,7 @@
 #ifndef PUSHKIN_META_INTEGER_SEQUENCE_HPP_
 #define PUSHKIN_META_INTEGER_SEQUENCE_HPP_
 
+#include <cstdint>
 #include <type_traits>
 #include <utility>
 
@@ -168,6 +169,291 @@ struct max : std::integral_constant<T, (A > B ? A : B)> {};
 template <typename T, T A, T B>
 struct min : std::integral_constant<T, (A < B ? A : B)> {};
 
+//@{
+/**
+ * Maximum and minimum of one or more values
+ */
+template < typename T, T ... Values >
+struct max_of;
+template < typename T, T V >
+struct max_of<T, V> : ::std::integral_constant<T, V> {};
+template < typename T, T A, T B, T ... Values >
+struct max_of<T, A, B, Values...> : max_of< T, max<T, A, B>::value, Values... > {};
+template < typename T, T ... Values >
+constexpr T max_of_v = max_of<T, Values...>::value;
+
+template < typename T, T ... Values >
+struct min_of;
+template < typename T, T V >
+struct min_of<T, V> : ::std::integral_constant<T, V> {};
+template < typename T, T A, T B, T ... Values >
+struct min_of<T, A, B, Values...> : min_of< T, min<T, A, B>::value, Values... > {};
+template < typename T, T ... Values >
+constexpr T min_of_v = min_of<T, Values...>::value;
+//@}
+
+/**
+ * Metafunction to select the smallest unsigned type that can hold
+ * values in range [0, Max]
+ */
+template < ::std::uint64_t Max >
+struct smallest_unsigned {
+    using type =
+        ::std::conditional_t< (Max <= 0xffu), ::std::uint8_t,
+        ::std::conditional_t< (Max <= 0xffffu), ::std::uint16_t,
+        ::std::conditional_t< (Max <= 0xffffffffu), ::std::uint32_t,
+            ::std::uint64_t > > >;
+};
+template < ::std::uint64_t Max >
+using smallest_unsigned_t = typename smallest_unsigned<Max>::type;
+
+
+namespace detail {
+
+/**
+ * Array that can be modified in C++14 constexpr functions
+ */
+template < typename T, ::std::size_t N >
+struct constexpr_array {
+    T data[N == 0 ? 1 : N];
+
+    constexpr T&
+    operator[](::std::size_t i) noexcept
+    { return data[i]; }
+    constexpr T const&
+    operator[](::std::size_t i) const noexcept
+    { return data[i]; }
+    static constexpr ::std::size_t
+    size() noexcept
+    { return N; }
+};
+
+template < typename T, T ... Values >
+constexpr constexpr_array<T, sizeof ... (Values)>
+sorted_values() noexcept
+{
+    constexpr_array<T, sizeof ... (Values)> res{{ Values... }};
+    // Insertion sort, sequences are short
+    for (::std::size_t i = 1; i < sizeof ... (Values); ++i) {
+        T v = res[i];
+        ::std::size_t j = i;
+        for (; j > 0 && v < res[j - 1]; --j)
+            res[j] = res[j - 1];
+        res[j] = v;
+    }
+    return res;
+}
+
+/**
+ * Values sorted once per sequence, the array is indexed when expanding the
+ * result instead of sorting again for every element
+ */
+template < typename T, T ... Values >
+struct sorted_values_of {
+    static constexpr constexpr_array<T, sizeof ... (Values)> value
+            = sorted_values<T, Values...>();
+};
+template < typename T, T ... Values >
+constexpr constexpr_array<T, sizeof ... (Values)> sorted_values_of<T, Values...>::value;
+
+/**
+ * Values without repetitions, in the order of the first occurrence,
+ * and the number of the values
+ */
+template < typename T, ::std::size_t N >
+struct unique_values_type {
+    constexpr_array<T, N>   values;
+    ::std::size_t           count;
+};
+
+template < typename T, T ... Values >
+constexpr unique_values_type<T, sizeof ... (Values)>
+unique_values() noexcept
+{
+    T const values[]{ Values..., T{} };
+    unique_values_type<T, sizeof ... (Values)> res{ {}, 0 };
+    for (::std::size_t i = 0; i < sizeof ... (Values); ++i) {
+        bool found = false;
+        for (::std::size_t j = 0; j < res.count; ++j)
+            found |= res.values[j] == values[i];
+        if (!found)
+            res.values[res.count++] = values[i];
+    }
+    return res;
+}
+
+/**
+ * Unique values computed once per sequence
+ */
+template < typename T, T ... Values >
+struct unique_values_of {
+    static constexpr unique_values_type<T, sizeof ... (Values)> value
+            = unique_values<T, Values...>();
+};
+template < typename T, T ... Values >
+constexpr unique_values_type<T, sizeof ... (Values)> unique_values_of<T, Values...>::value;
+
+template < typename T, T ... Values >
+constexpr ::std::size_t
+count_less(::std::integer_sequence<T, Values...> const&, T value) noexcept
+{
+    T const values[]{ Values..., T{} };
+    ::std::size_t count = 0;
+    for (::std::size_t i = 0; i < sizeof ... (Values); ++i)
+        count += values[i] < value;
+    return count;
+}
+
+template < typename Sequence, typename Indexes >
+struct sort_impl;
+
+template < typename T, T ... Values, ::std::size_t ... I >
+struct sort_impl< ::std::integer_sequence<T, Values...>, ::std::index_sequence<I...> > {
+    using type = ::std::integer_sequence<T, sorted_values_of<T, Values...>::value[I]...>;
+};
+
+} /* namespace detail */
+
+//@{
+/**
+ * Metafunction to sort an integer sequence in ascending order.
+ * The sort is a constexpr array sort, not a recursive instantiation.
+ */
+template < typename Sequence >
+struct sort;
+
+template < typename T, T ... Values >
+struct sort< ::std::integer_sequence<T, Values...> >
+    : detail::sort_impl< ::std::integer_sequence<T, Values...>,
+            ::std::make_index_sequence<sizeof ... (Values)> > {};
+
+template < typename Sequence >
+using sort_t = typename sort<Sequence>::type;
+//@}
+
+//@{
+/**
+ * Metafunction to find the index of the first element of a sorted
+ * integer sequence that is not less than the value. If there is no
+ * such element the index is the size of the sequence.
+ */
+template < typename Sequence, typename Sequence::value_type Value >
+struct lower_bound
+    : ::std::integral_constant< ::std::size_t,
+        detail::count_less(Sequence{}, Value) > {};
+
+template < typename Sequence, typename Sequence::value_type Value >
+constexpr ::std::size_t lower_bound_v = lower_bound<Sequence, Value>::value;
+//@}
+
+namespace detail {
+
+template < typename T, T ... Values >
+constexpr T
+sequence_sum(::std::integer_sequence<T, Values...> const&) noexcept
+{
+    T const values[]{ Values..., T{} };
+    T sum{};
+    for (::std::size_t i = 0; i < sizeof ... (Values); ++i)
+        sum += values[i];
+    return sum;
+}
+
+/**
+ * Sum of the first N values
+ */
+template < typename T, T ... Values >
+constexpr T
+sequence_prefix_sum(::std::size_t n) noexcept
+{
+    T const values[]{ Values..., T{} };
+    T sum{};
+    for (::std::size_t i = 0; i < n; ++i)
+        sum += values[i];
+    return sum;
+}
+
+template < typename T, T ... Values >
+constexpr T
+sequence_value(::std::integer_sequence<T, Values...> const&, ::std::size_t n) noexcept
+{
+    T const values[]{ Values..., T{} };
+    return values[n];
+}
+
+template < typename Sequence, ::std::size_t First, typename Indexes >
+struct scan_impl;
+
+template < typename T, T ... Values, ::std::size_t First, ::std::size_t ... I >
+struct scan_impl< ::std::integer_sequence<T, Values...>, First, ::std::index_sequence<I...> > {
+    using type = ::std::integer_sequence<T,
+            sequence_prefix_sum<T, Values...>(I + First)...>;
+};
+
+} /* namespace detail */
+
+//@{
+/**
+ * Metafunction to get the N-th value of an integer sequence
+ */
+template < ::std::size_t N, typename Sequence >
+struct nth_value
+    : ::std::integral_constant< typename Sequence::value_type,
+        detail::sequence_value(Sequence{}, N) > {
+    static_assert(N < Sequence::size(), "Index is out of range");
+};
+
+template < ::std::size_t N, typename Sequence >
+constexpr typename Sequence::value_type nth_value_v = nth_value<N, Sequence>::value;
+//@}
+
+//@{
+/**
+ * Metafunction to sum values of an integer sequence
+ */
+template < typename Sequence >
+struct sum
+    : ::std::integral_constant< typename Sequence::value_type,
+        detail::sequence_sum(Sequence{}) > {};
+
+template < typename Sequence >
+constexpr typename Sequence::value_type sum_v = sum<Sequence>::value;
+//@}
+
+//@{
+/**
+ * Metafunction to build a sequence of prefix sums of an integer sequence,
+ * the N-th value of the result is the sum of the values [0, N]
+ */
+template < typename Sequence >
+struct inclusive_scan;
+
+template < typename T, T ... Values >
+struct inclusive_scan< ::std::integer_sequence<T, Values...> >
+    : detail::scan_impl< ::std::integer_sequence<T, Values...>, 1,
+        ::std::make_index_sequence<sizeof ... (Values)> > {};
+
+template < typename Sequence >
+using inclusive_scan_t = typename inclusive_scan<Sequence>::type;
+//@}
+
+//@{
+/**
+ * Metafunction to build a sequence of prefix sums of an integer sequence,
+ * the N-th value of the result is the sum of the values [0, N).
+ * Applied to sizes it gives offsets.
+ */
+template < typename Sequence >
+struct exclusive_scan;
+
+template < typename T, T ... Values >
+struct exclusive_scan< ::std::integer_sequence<T, Values...> >
+    : detail::scan_impl< ::std::integer_sequence<T, Values...>, 0,
+        ::std::make_index_sequence<sizeof ... (Values)> > {};
+
+template < typename Sequence >
+using exclusive_scan_t = typename exclusive_scan<Sequence>::type;
+//@}
 
 } /* namespace meta */
 } /* namespace psst */
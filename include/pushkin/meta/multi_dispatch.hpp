@@ -0,0 +1,329 @@
+/*
+ * multi_dispatch.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_META_MULTI_DISPATCH_HPP_
+#define PUSHKIN_META_MULTI_DISPATCH_HPP_
+
+#include <pushkin/meta/type_tuple.hpp>
+#include <pushkin/meta/integer_sequence.hpp>
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace psst {
+namespace meta {
+
+namespace detail {
+
+/**
+ * Row-major stride of a dimension of the dispatch table
+ */
+template < typename ... Tuples >
+constexpr ::std::size_t
+dispatch_stride(::std::size_t dim)
+{
+    ::std::size_t const sizes[]{ Tuples::size... };
+    ::std::size_t stride = 1;
+    for (auto i = dim + 1; i < sizeof ... (Tuples); ++i)
+        stride *= sizes[i];
+    return stride;
+}
+
+template < typename ... Tuples >
+constexpr ::std::size_t
+dispatch_table_size()
+{
+    ::std::size_t const sizes[]{ Tuples::size... };
+    ::std::size_t size = 1;
+    for (auto sz : sizes)
+        size *= sz;
+    return size;
+}
+
+/**
+ * Types of a dispatch table cell
+ */
+template < ::std::size_t Flat, typename Tuples, typename Dims >
+struct dispatch_cell;
+
+template < ::std::size_t Flat, typename ... Tuples, ::std::size_t ... Dims >
+struct dispatch_cell< Flat, type_tuple<Tuples...>, ::std::index_sequence<Dims...> > {
+    using type = type_tuple<
+        typename Tuples::template type<
+            (Flat / dispatch_stride<Tuples...>(Dims)) % Tuples::size >... >;
+};
+
+template < typename Result, typename Func, typename Cell >
+struct dispatch_thunk;
+
+template < typename Result, typename Func, typename ... Types >
+struct dispatch_thunk< Result, Func, type_tuple<Types...> > {
+    template < typename Fallback >
+    static Result
+    call(Func& func, Fallback&, ::std::size_t const*)
+    {
+        return func(type_c<Types>...);
+    }
+};
+
+template < typename Tuples >
+struct dispatch_dims;
+
+template < typename ... Tuples >
+struct dispatch_dims< type_tuple<Tuples...> > {
+    static_assert(sizeof ... (Tuples) > 0, "Nothing to dispatch on");
+    static_assert(dispatch_table_size<Tuples...>() > 0,
+            "Cannot dispatch on an empty type tuple");
+
+    using dims      = ::std::index_sequence_for<Tuples...>;
+    using first     = typename dispatch_cell<0, type_tuple<Tuples...>, dims>::type;
+    static constexpr ::std::size_t size = dispatch_table_size<Tuples...>();
+
+    template < ::std::size_t Flat >
+    using cell = typename dispatch_cell<Flat, type_tuple<Tuples...>, dims>::type;
+
+    static ::std::size_t
+    flat_index(::std::size_t const* indexes) noexcept
+    {
+        ::std::size_t flat = 0;
+        for (::std::size_t i = 0; i < sizeof ... (Tuples); ++i)
+            flat += indexes[i] * dispatch_stride<Tuples...>(i);
+        return flat;
+    }
+
+    static bool
+    in_range(::std::size_t const* indexes) noexcept
+    {
+        ::std::size_t const sizes[]{ Tuples::size... };
+        for (::std::size_t i = 0; i < sizeof ... (Tuples); ++i) {
+            if (indexes[i] >= sizes[i])
+                return false;
+        }
+        return true;
+    }
+};
+
+template < typename Func, typename ... Types >
+auto
+dispatch_result_impl(Func& func, type_tuple<Types...> const&)
+    -> decltype(func(type_c<Types>...));
+
+template < typename Func, typename Dims >
+using dispatch_result_t = decltype(dispatch_result_impl(
+        ::std::declval<Func&>(), typename Dims::first{}));
+
+struct no_fallback {};
+
+template < typename Dims, typename Func, ::std::size_t ... Flat >
+dispatch_result_t<Func, Dims>
+dense_dispatch(::std::size_t flat, Func& func, ::std::index_sequence<Flat...> const&)
+{
+    using result_type   = dispatch_result_t<Func, Dims>;
+    using thunk_type    = result_type(*)(Func&, no_fallback&, ::std::size_t const*);
+    static constexpr thunk_type table[]{
+        &dispatch_thunk<result_type, Func,
+                typename Dims::template cell<Flat>>::template call<no_fallback>... };
+    no_fallback fb;
+    return table[flat](func, fb, nullptr);
+}
+
+template < typename Tuples, typename Args, ::std::size_t ... Dims >
+decltype(auto)
+multi_dispatch_impl(Args&& args, ::std::index_sequence<Dims...> const&)
+{
+    using dims      = dispatch_dims<Tuples>;
+    using func_type = ::std::remove_reference_t<
+            ::std::tuple_element_t<sizeof ... (Dims), ::std::decay_t<Args>>>;
+    ::std::size_t const indexes[]{ static_cast<::std::size_t>(::std::get<Dims>(args))... };
+    func_type& func = ::std::get<sizeof ... (Dims)>(args);
+    return dense_dispatch<dims>(dims::flat_index(indexes), func,
+            ::std::make_index_sequence<dims::size>{});
+}
+
+//@{
+/** @name Sparse table construction */
+template < template <typename...> class Valid, typename Cell >
+struct is_valid_cell;
+
+template < template <typename...> class Valid, typename ... Types >
+struct is_valid_cell< Valid, type_tuple<Types...> >
+    : ::std::integral_constant<bool, Valid<Types...>::value> {};
+
+template < bool ... Valid >
+constexpr ::std::size_t
+valid_cell_count()
+{
+    bool const valid[]{ false, Valid... };
+    ::std::size_t count = 0;
+    for (auto v : valid)
+        count += v;
+    return count;
+}
+
+/**
+ * Slot of a cell in the thunk table, 0 is the fallback
+ */
+template < bool ... Valid >
+constexpr ::std::size_t
+valid_cell_slot(::std::size_t flat)
+{
+    bool const valid[]{ Valid..., false };
+    if (!valid[flat])
+        return 0;
+    ::std::size_t slot = 1;
+    for (::std::size_t i = 0; i < flat; ++i)
+        slot += valid[i];
+    return slot;
+}
+
+/**
+ * Flat index of the n-th valid cell
+ */
+template < bool ... Valid >
+constexpr ::std::size_t
+nth_valid_cell(::std::size_t n)
+{
+    bool const valid[]{ Valid..., false };
+    ::std::size_t i = 0;
+    for (; i < sizeof ... (Valid); ++i) {
+        if (valid[i] && n-- == 0)
+            break;
+    }
+    return i;
+}
+
+template < typename Result, typename Func, typename Dims >
+struct fallback_thunk {
+    template < typename Fallback >
+    static Result
+    call(Func&, Fallback& fallback, ::std::size_t const* indexes)
+    {
+        return call(fallback, indexes, typename Dims::dims{});
+    }
+    template < typename Fallback, ::std::size_t ... D >
+    static Result
+    call(Fallback& fallback, ::std::size_t const* indexes, ::std::index_sequence<D...> const&)
+    {
+        return fallback(indexes[D]...);
+    }
+};
+
+template < typename Dims, template <typename...> class Valid, typename Flat >
+struct sparse_table;
+
+template < typename Dims, template <typename...> class Valid, ::std::size_t ... Flat >
+struct sparse_table< Dims, Valid, ::std::index_sequence<Flat...> > {
+    static constexpr ::std::size_t valid_count =
+            valid_cell_count< is_valid_cell<Valid, typename Dims::template cell<Flat>>::value... >();
+    using slot_type = smallest_unsigned_t<valid_count>;
+
+    template < ::std::size_t N >
+    using nth_cell = typename Dims::template cell<
+            nth_valid_cell< is_valid_cell<Valid, typename Dims::template cell<Flat>>::value... >(N) >;
+
+    template < typename Func, typename Fallback >
+    static dispatch_result_t<Func, Dims>
+    call(::std::size_t const* indexes, Func& func, Fallback& fallback)
+    {
+        static constexpr slot_type slots[]{ static_cast<slot_type>(
+                valid_cell_slot< is_valid_cell<Valid,
+                    typename Dims::template cell<Flat>>::value... >(Flat))... };
+        auto slot = Dims::in_range(indexes) ? slots[Dims::flat_index(indexes)] : 0;
+        return thunks<Func, Fallback>(::std::make_index_sequence<valid_count>{})[slot](
+                func, fallback, indexes);
+    }
+
+    template < typename Func, typename Fallback, ::std::size_t ... N >
+    static auto
+    thunks(::std::index_sequence<N...> const&)
+    {
+        using result_type   = dispatch_result_t<Func, Dims>;
+        using thunk_type    = result_type(*)(Func&, Fallback&, ::std::size_t const*);
+        static constexpr thunk_type table[]{
+            &fallback_thunk<result_type, Func, Dims>::template call<Fallback>,
+            &dispatch_thunk<result_type, Func, nth_cell<N>>::template call<Fallback>... };
+        return table;
+    }
+};
+
+template < template <typename...> class Valid, typename Tuples,
+        typename Args, ::std::size_t ... Dims >
+decltype(auto)
+sparse_dispatch_impl(Args&& args, ::std::index_sequence<Dims...> const&)
+{
+    using dims          = dispatch_dims<Tuples>;
+    using arg_types     = ::std::decay_t<Args>;
+    using func_type     = ::std::remove_reference_t<
+            ::std::tuple_element_t<sizeof ... (Dims), arg_types>>;
+    using fallback_type = ::std::remove_reference_t<
+            ::std::tuple_element_t<sizeof ... (Dims) + 1, arg_types>>;
+    using table         = sparse_table<dims, Valid, ::std::make_index_sequence<dims::size>>;
+
+    ::std::size_t const indexes[]{ static_cast<::std::size_t>(::std::get<Dims>(args))... };
+    func_type& func = ::std::get<sizeof ... (Dims)>(args);
+    fallback_type& fallback = ::std::get<sizeof ... (Dims) + 1>(args);
+    return table::call(indexes, func, fallback);
+}
+//@}
+
+}  /* namespace detail */
+
+/**
+ * Call a function with type constants of types selected by runtime
+ * indexes in two or more type tuples.
+ *
+ * A flat row-major table of thunks for every combination of types is
+ * generated at compile time, the call is a single indirect call.
+ * Indexes must be in range of the corresponding type tuples.
+ *
+ * Usage:
+ * @code
+ * using shapes = type_tuple<circle, box, polygon>;
+ * multi_dispatch<shapes, shapes>(a.kind, b.kind,
+ *     [&](auto a, auto b) {
+ *         return collide< typename decltype(a)::type, typename decltype(b)::type >(...);
+ *     });
+ * @endcode
+ * @param args Index for each type tuple followed by the function
+ */
+template < typename ... Tuples, typename ... Args >
+decltype(auto)
+multi_dispatch(Args&& ... args)
+{
+    static_assert(sizeof ... (Args) == sizeof ... (Tuples) + 1,
+            "Expected an index for each type tuple and a function");
+    return detail::multi_dispatch_impl< type_tuple<Tuples...> >(
+            ::std::forward_as_tuple(::std::forward<Args>(args)...),
+            ::std::index_sequence_for<Tuples...>{});
+}
+
+/**
+ * Sparse version of multi_dispatch. Only combinations of types for which
+ * Valid<Types...>::value is true get a thunk, the rest and indexes out of
+ * range go to the fallback, that is called with the indexes.
+ * The table holds the smallest possible unsigned slot per combination and
+ * a thunk per valid combination.
+ *
+ * @param args Index for each type tuple, the function, the fallback
+ */
+template < template <typename...> class Valid, typename ... Tuples, typename ... Args >
+decltype(auto)
+multi_dispatch_sparse(Args&& ... args)
+{
+    static_assert(sizeof ... (Args) == sizeof ... (Tuples) + 2,
+            "Expected an index for each type tuple, a function and a fallback");
+    return detail::sparse_dispatch_impl< Valid, type_tuple<Tuples...> >(
+            ::std::forward_as_tuple(::std::forward<Args>(args)...),
+            ::std::index_sequence_for<Tuples...>{});
+}
+
+}  /* namespace meta */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_META_MULTI_DISPATCH_HPP_ */
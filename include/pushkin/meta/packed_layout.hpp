@@ -0,0 +1,197 @@
+/*
+ * packed_layout.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_META_PACKED_LAYOUT_HPP_
+#define PUSHKIN_META_PACKED_LAYOUT_HPP_
+
+#include <pushkin/meta/integer_sequence.hpp>
+#include <pushkin/meta/algorithm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace psst {
+namespace meta {
+
+/**
+ * Byte order of values in a buffer
+ */
+enum class byte_order {
+    little,
+    big,
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    native = big
+#else
+    native = little
+#endif
+};
+
+namespace detail {
+
+template < ::std::size_t Size >
+struct byte_swap_impl {
+    template < typename T >
+    static T
+    apply(T value) noexcept
+    {
+        unsigned char bytes[Size];
+        ::std::memcpy(bytes, &value, Size);
+        for (::std::size_t i = 0; i < Size / 2; ++i) {
+            auto tmp = bytes[i];
+            bytes[i] = bytes[Size - 1 - i];
+            bytes[Size - 1 - i] = tmp;
+        }
+        ::std::memcpy(&value, bytes, Size);
+        return value;
+    }
+};
+
+template <>
+struct byte_swap_impl<1> {
+    template < typename T >
+    static T
+    apply(T value) noexcept
+    { return value; }
+};
+
+#if defined(__GNUC__)
+template < typename U, U (*Swap)(U) >
+struct builtin_byte_swap {
+    template < typename T >
+    static T
+    apply(T value) noexcept
+    {
+        U bits;
+        ::std::memcpy(&bits, &value, sizeof(U));
+        bits = Swap(bits);
+        ::std::memcpy(&value, &bits, sizeof(U));
+        return value;
+    }
+};
+
+inline ::std::uint16_t
+bswap16(::std::uint16_t v) noexcept
+{ return __builtin_bswap16(v); }
+inline ::std::uint32_t
+bswap32(::std::uint32_t v) noexcept
+{ return __builtin_bswap32(v); }
+inline ::std::uint64_t
+bswap64(::std::uint64_t v) noexcept
+{ return __builtin_bswap64(v); }
+
+template <>
+struct byte_swap_impl<2> : builtin_byte_swap<::std::uint16_t, bswap16> {};
+template <>
+struct byte_swap_impl<4> : builtin_byte_swap<::std::uint32_t, bswap32> {};
+template <>
+struct byte_swap_impl<8> : builtin_byte_swap<::std::uint64_t, bswap64> {};
+#endif
+
+}  /* namespace detail */
+
+/**
+ * Reverse the bytes of a trivially copyable value
+ */
+template < typename T >
+T
+byte_swap(T value) noexcept
+{
+    static_assert(::std::is_trivially_copyable<T>::value,
+            "Only trivially copyable values can be byte swapped");
+    return detail::byte_swap_impl<sizeof(T)>::apply(value);
+}
+
+template < typename Schema, byte_order Order = byte_order::native >
+struct packed_layout;
+
+/**
+ * Layout of a wire format record with fields of types in a type tuple
+ * placed one after another without padding. Field offsets are computed at
+ * compile time, so an access is a single unaligned load or store at a
+ * constant offset, followed by a byte swap if the byte order is not
+ * native.
+ *
+ * Field types must be trivially copyable.
+ *
+ * Usage:
+ * @code
+ * using header = packed_layout<
+ *         type_tuple<::std::uint8_t, ::std::uint16_t, ::std::uint32_t>,
+ *         byte_order::big >;
+ * static_assert(header::offset<2> == 3, "");
+ * auto length = header::load<2>(buffer);
+ * header::store<1>(buffer, 42);
+ * @endcode
+ */
+template < typename ... T, byte_order Order >
+struct packed_layout< type_tuple<T...>, Order > {
+    static_assert(sizeof ... (T) > 0, "Layout must have at least one field");
+    static_assert(all_match< ::std::is_trivially_copyable, T... >::value,
+            "Packed field types must be trivially copyable");
+
+    using schema    = type_tuple<T...>;
+    using sizes     = ::std::index_sequence< sizeof(T)... >;
+    using offsets   = exclusive_scan_t< sizes >;
+
+    static constexpr byte_order order           = Order;
+    static constexpr bool swap_bytes            = Order != byte_order::native;
+    static constexpr ::std::size_t field_count  = sizeof ... (T);
+    /**
+     * Size of the packed record in bytes
+     */
+    static constexpr ::std::size_t size         = sum_v< sizes >;
+
+    template < ::std::size_t I >
+    using field_type    = typename schema::template type<I>;
+
+    template < ::std::size_t I >
+    static constexpr ::std::size_t field_size   = sizeof(field_type<I>);
+    template < ::std::size_t I >
+    static constexpr ::std::size_t offset       = nth_value_v< I, offsets >;
+
+    /**
+     * Read a field from a buffer of at least size bytes
+     */
+    template < ::std::size_t I >
+    static field_type<I>
+    load(void const* buffer) noexcept
+    {
+        field_type<I> value;
+        ::std::memcpy(&value,
+                static_cast<unsigned char const*>(buffer) + offset<I>, sizeof(value));
+        return convert(value, ::std::integral_constant<bool, swap_bytes>{});
+    }
+    /**
+     * Write a field to a buffer of at least size bytes, the value is
+     * converted to the field type
+     */
+    template < ::std::size_t I, typename U >
+    static void
+    store(void* buffer, U const& value) noexcept
+    {
+        field_type<I> field = convert(static_cast<field_type<I>>(value),
+                ::std::integral_constant<bool, swap_bytes>{});
+        ::std::memcpy(static_cast<unsigned char*>(buffer) + offset<I>,
+                &field, sizeof(field));
+    }
+private:
+    template < typename U >
+    static U
+    convert(U value, ::std::false_type const&) noexcept
+    { return value; }
+    template < typename U >
+    static U
+    convert(U value, ::std::true_type const&) noexcept
+    { return byte_swap(value); }
+};
+
+}  /* namespace meta */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_META_PACKED_LAYOUT_HPP_ */
@@ -0,0 +1,401 @@
+/*
+ * parse_number.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_META_PARSE_NUMBER_HPP_
+#define PUSHKIN_META_PARSE_NUMBER_HPP_
+
+#include <pushkin/meta/char_sequence.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace psst {
+namespace meta {
+
+enum class parse_error {
+    none,
+    empty,
+    invalid_digit,
+    overflow,
+    precision_loss
+};
+
+namespace detail {
+
+constexpr int
+digit_value(char c) noexcept
+{
+    return ('0' <= c && c <= '9') ? c - '0'
+         : ('a' <= c && c <= 'z') ? c - 'a' + 10
+         : ('A' <= c && c <= 'Z') ? c - 'A' + 10
+         : -1;
+}
+
+template < typename T >
+struct integer_parser {
+    T           value;
+    parse_error error;
+    bool        negative;
+    bool        has_digits;
+
+    /**
+     * Append a digit, the value is accumulated with the sign, so that the
+     * minimum value of a signed type can be parsed
+     */
+    constexpr bool
+    push(int digit, int base) noexcept
+    {
+        if (digit < 0 || digit >= base) {
+            error = parse_error::invalid_digit;
+            return false;
+        }
+        has_digits = true;
+        T const d = static_cast<T>(digit);
+        T const b = static_cast<T>(base);
+        if (negative) {
+            if (value < (::std::numeric_limits<T>::min() + d) / b) {
+                error = parse_error::overflow;
+                return false;
+            }
+            value = value * b - d;
+        } else {
+            if (value > (::std::numeric_limits<T>::max() - d) / b) {
+                error = parse_error::overflow;
+                return false;
+            }
+            value = value * b + d;
+        }
+        return true;
+    }
+
+    /**
+     * Parse an optional sign
+     */
+    constexpr ::std::size_t
+    sign(char const* str, ::std::size_t size) noexcept
+    {
+        if (size > 0 && (str[0] == '-' || str[0] == '+')) {
+            negative = str[0] == '-';
+            if (negative && !::std::is_signed<T>::value)
+                error = parse_error::invalid_digit;
+            return 1;
+        }
+        return 0;
+    }
+
+    constexpr integer_parser&
+    finish() noexcept
+    {
+        if (error == parse_error::none && !has_digits)
+            error = parse_error::empty;
+        if (error != parse_error::none)
+            value = T{};
+        return *this;
+    }
+};
+
+/**
+ * Parse an integer with an optional sign and a base prefix: 0x for
+ * hexadecimal, 0b for binary and a leading 0 for octal. Digit separators
+ * are skipped.
+ */
+template < typename T, char ... Chars >
+constexpr integer_parser<T>
+parse_integer(char_sequence<Chars...> const&) noexcept
+{
+    char const str[]{ Chars..., 0 };
+    constexpr ::std::size_t size = sizeof ... (Chars);
+    integer_parser<T> parser{ T{}, parse_error::none, false, false };
+    ::std::size_t pos = parser.sign(str, size);
+    int base = 10;
+    if (size - pos > 1 && str[pos] == '0') {
+        if (str[pos + 1] == 'x' || str[pos + 1] == 'X') {
+            base = 16;
+            pos += 2;
+        } else if (str[pos + 1] == 'b' || str[pos + 1] == 'B') {
+            base = 2;
+            pos += 2;
+        } else {
+            base = 8;
+            ++pos;
+        }
+    }
+    for (; pos < size && parser.error == parse_error::none; ++pos) {
+        if (str[pos] != '\'')
+            parser.push(digit_value(str[pos]), base);
+    }
+    return parser.finish();
+}
+
+/**
+ * Parse a decimal number to an integer scaled by 10^Fraction.
+ * Fraction digits beyond the scale must be zero.
+ */
+template < typename T, ::std::size_t Fraction, char ... Chars >
+constexpr integer_parser<T>
+parse_fixed(char_sequence<Chars...> const&) noexcept
+{
+    char const str[]{ Chars..., 0 };
+    constexpr ::std::size_t size = sizeof ... (Chars);
+    integer_parser<T> parser{ T{}, parse_error::none, false, false };
+    ::std::size_t pos = parser.sign(str, size);
+    bool point = false;
+    ::std::size_t fraction = 0;
+    for (; pos < size && parser.error == parse_error::none; ++pos) {
+        if (str[pos] == '\'')
+            continue;
+        if (str[pos] == '.' && !point) {
+            point = true;
+            continue;
+        }
+        if (point && fraction == Fraction) {
+            if (str[pos] != '0') {
+                parser.error = digit_value(str[pos]) < 0 || digit_value(str[pos]) > 9
+                        ? parse_error::invalid_digit : parse_error::precision_loss;
+            }
+            continue;
+        }
+        parser.push(digit_value(str[pos]), 10);
+        if (point)
+            ++fraction;
+    }
+    for (; fraction < Fraction && parser.error == parse_error::none; ++fraction)
+        parser.push(0, 10);
+    return parser.finish();
+}
+
+constexpr double
+pow10(int exp) noexcept
+{
+    double res = 1;
+    for (int i = 0; i < exp; ++i)
+        res *= 10;
+    return res;
+}
+
+struct double_parser {
+    double      value;
+    parse_error error;
+};
+
+/**
+ * Parse a decimal floating point number.
+ *
+ * Numbers with a mantissa that fits in 53 bits and a power of ten up to
+ * 10^22 are converted with the Clinger fast path: both the mantissa and
+ * the power of ten are exact doubles, so a single multiplication or
+ * division is correctly rounded. Other numbers are scaled in long double
+ * and may differ from the correctly rounded value in the last bit.
+ */
+template < char ... Chars >
+constexpr double_parser
+parse_double(char_sequence<Chars...> const&) noexcept
+{
+    char const str[]{ Chars..., 0 };
+    constexpr ::std::size_t size = sizeof ... (Chars);
+    constexpr ::std::uint64_t max_exact = ::std::uint64_t{1} << 53;
+    constexpr ::std::uint64_t max_mantissa = 1000000000000000000ull;
+    constexpr int max_exact_pow10 = 22;
+
+    double_parser res{ 0, parse_error::none };
+    ::std::size_t pos = 0;
+    bool negative = false;
+    if (size > 0 && (str[0] == '-' || str[0] == '+')) {
+        negative = str[0] == '-';
+        ++pos;
+    }
+    ::std::uint64_t mantissa = 0;
+    int exp10 = 0;
+    bool digits = false, point = false, truncated = false;
+    for (; pos < size && str[pos] != 'e' && str[pos] != 'E'; ++pos) {
+        if (str[pos] == '\'')
+            continue;
+        if (str[pos] == '.' && !point) {
+            point = true;
+            continue;
+        }
+        int d = digit_value(str[pos]);
+        if (d < 0 || d > 9) {
+            res.error = parse_error::invalid_digit;
+            return res;
+        }
+        digits = true;
+        if (mantissa < max_mantissa) {
+            mantissa = mantissa * 10 + d;
+            if (point)
+                --exp10;
+        } else {
+            truncated = truncated || d != 0;
+            if (!point)
+                ++exp10;
+        }
+    }
+    if (!digits) {
+        res.error = parse_error::empty;
+        return res;
+    }
+    if (pos < size) {
+        integer_parser<int> exp{ 0, parse_error::none, false, false };
+        pos += 1;
+        pos += exp.sign(str + pos, size - pos);
+        for (; pos < size && exp.error == parse_error::none; ++pos)
+            exp.push(digit_value(str[pos]), 10);
+        exp.finish();
+        if (exp.error != parse_error::none) {
+            res.error = exp.error == parse_error::overflow
+                    ? parse_error::overflow : parse_error::invalid_digit;
+            return res;
+        }
+        exp10 += exp.value;
+    }
+
+    if (mantissa == 0) {
+        res.value = negative ? -0.0 : 0.0;
+        return res;
+    }
+    if (!truncated && mantissa <= max_exact
+            && exp10 >= -max_exact_pow10 && exp10 <= 2 * max_exact_pow10) {
+        // Clinger fast path
+        double value = static_cast<double>(mantissa);
+        bool exact = true;
+        if (exp10 < 0) {
+            value /= pow10(-exp10);
+        } else if (exp10 <= max_exact_pow10) {
+            value *= pow10(exp10);
+        } else {
+            // Move the excess of the exponent to the mantissa if it stays exact
+            value *= pow10(exp10 - max_exact_pow10);
+            exact = value <= static_cast<double>(max_exact);
+            value *= pow10(max_exact_pow10);
+        }
+        if (exact) {
+            res.value = negative ? -value : value;
+            return res;
+        }
+    }
+
+    long double value = static_cast<long double>(mantissa);
+    constexpr long double max = ::std::numeric_limits<double>::max();
+    for (; exp10 > 0; --exp10) {
+        if (value > max / 10) {
+            res.error = parse_error::overflow;
+            return res;
+        }
+        value *= 10;
+    }
+    for (; exp10 < 0 && value != 0; ++exp10)
+        value /= 10;
+    res.value = static_cast<double>(negative ? -value : value);
+    return res;
+}
+
+template < parse_error Error >
+struct check_parse_error {
+    static_assert(Error != parse_error::empty, "Number has no digits");
+    static_assert(Error != parse_error::invalid_digit, "Invalid character in the number");
+    static_assert(Error != parse_error::overflow, "Number is out of range of the type");
+    static_assert(Error != parse_error::precision_loss,
+            "Number has more fraction digits than the fixed point scale");
+    static constexpr bool value = Error == parse_error::none;
+};
+
+}  /* namespace detail */
+
+//@{
+/**
+ * Metafunction to parse an integer from a char sequence, base prefixes
+ * 0x, 0b and 0 for octal are supported. Invalid characters and overflow
+ * fail compilation.
+ *
+ * Usage:
+ * @code
+ * using namespace ::psst::meta::literals;
+ * static_assert(parse_integer_v< int, decltype(0x1F_cs) > == 31, "");
+ * @endcode
+ */
+template < typename T, typename Sequence >
+struct parse_integer;
+
+template < typename T, char ... Chars >
+struct parse_integer< T, char_sequence<Chars...> >
+    : ::std::integral_constant< T,
+        detail::parse_integer<T>(char_sequence<Chars...>{}).value > {
+    static_assert(::std::is_integral<T>::value, "Integral type is required");
+    static_assert(detail::check_parse_error<
+            detail::parse_integer<T>(char_sequence<Chars...>{}).error >::value, "");
+};
+
+template < typename T, typename Sequence >
+constexpr T parse_integer_v = parse_integer<T, Sequence>::value;
+//@}
+
+//@{
+/**
+ * Metafunction to parse a decimal fixed point number to an integer
+ * with Fraction decimal digits after the point, e.g. 12.5 with two
+ * fraction digits is 1250. Non-zero digits beyond the scale fail
+ * compilation.
+ */
+template < typename T, ::std::size_t Fraction, typename Sequence >
+struct parse_fixed;
+
+template < typename T, ::std::size_t Fraction, char ... Chars >
+struct parse_fixed< T, Fraction, char_sequence<Chars...> >
+    : ::std::integral_constant< T,
+        detail::parse_fixed<T, Fraction>(char_sequence<Chars...>{}).value > {
+    static_assert(::std::is_integral<T>::value, "Integral type is required");
+    static_assert(detail::check_parse_error<
+            detail::parse_fixed<T, Fraction>(char_sequence<Chars...>{}).error >::value, "");
+};
+
+template < typename T, ::std::size_t Fraction, typename Sequence >
+constexpr T parse_fixed_v = parse_fixed<T, Fraction, Sequence>::value;
+//@}
+
+//@{
+/**
+ * Metafunction to parse a decimal floating point number
+ */
+template < typename Sequence >
+struct parse_double;
+
+template < char ... Chars >
+struct parse_double< char_sequence<Chars...> > {
+    static_assert(detail::check_parse_error<
+            detail::parse_double(char_sequence<Chars...>{}).error >::value, "");
+    using value_type = double;
+    static constexpr double value = detail::parse_double(char_sequence<Chars...>{}).value;
+};
+
+template < char ... Chars >
+constexpr double parse_double< char_sequence<Chars...> >::value;
+
+template < typename Sequence >
+constexpr double parse_double_v = parse_double<Sequence>::value;
+//@}
+
+/**
+ * Convert a char sequence literal to an integral constant
+ *
+ * Usage:
+ * @code
+ * using namespace ::psst::meta::literals;
+ * constexpr auto mask = to_integral<::std::uint32_t>(0xff00_cs);
+ * ::std::array<int, decltype(mask)::value> buffer;
+ * @endcode
+ */
+template < typename T, char ... Chars >
+constexpr parse_integer< T, char_sequence<Chars...> >
+to_integral(char_sequence<Chars...> const&) noexcept
+{ return {}; }
+
+}  /* namespace meta */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_META_PARSE_NUMBER_HPP_ */
@@ -0,0 +1,135 @@
+/*
+ * record_layout.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_META_RECORD_LAYOUT_HPP_
+#define PUSHKIN_META_RECORD_LAYOUT_HPP_
+
+#include <pushkin/meta/type_id.hpp>
+#include <pushkin/meta/integer_sequence.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace psst {
+namespace meta {
+
+namespace detail {
+
+/**
+ * Kind of a field, part of the schema hash
+ */
+template < typename T >
+constexpr ::std::uint64_t
+field_kind() noexcept
+{
+    return ::std::is_same<T, bool>::value           ? 1
+         : ::std::is_enum<T>::value                 ? 2
+         : ::std::is_floating_point<T>::value       ? 3
+         : ::std::is_signed<T>::value               ? 4
+         : ::std::is_unsigned<T>::value             ? 5
+         : 0;
+}
+
+template < ::std::size_t ... Sizes >
+struct field_offsets {
+    /**
+     * Offset of a field. Alignment of the field after the last one is the
+     * record alignment, so it's offset is the padded record size.
+     */
+    static constexpr ::std::size_t
+    offset(::std::size_t field, ::std::size_t const* aligns) noexcept
+    {
+        ::std::size_t const sizes[]{ Sizes..., 0 };
+        ::std::size_t offset = 0;
+        for (::std::size_t i = 0; i <= field; ++i) {
+            offset = (offset + aligns[i] - 1) / aligns[i] * aligns[i];
+            if (i < field)
+                offset += sizes[i];
+        }
+        return offset;
+    }
+};
+
+}  /* namespace detail */
+
+template < typename Schema >
+struct record_layout;
+
+/**
+ * Binary layout of a record with fields of types in a type tuple.
+ * Fields are placed in order at offsets aligned by the field's alignment,
+ * the record size is padded to the record alignment, like a C struct with
+ * the same members.
+ *
+ * Field types must be trivially copyable.
+ *
+ * The schema hash covers the field kinds, sizes, alignments and offsets
+ * and is the same for all compilers using the same layout.
+ *
+ * Usage:
+ * @code
+ * using trade = record_layout< type_tuple<::std::int64_t, double, ::std::uint32_t> >;
+ * static_assert(trade::offset<2> == 16, "");
+ * static_assert(trade::size == 24, "");
+ * @endcode
+ */
+template < typename ... T >
+struct record_layout< type_tuple<T...> > {
+    static_assert(sizeof ... (T) > 0, "Record must have at least one field");
+    static_assert(all_match< ::std::is_trivially_copyable, T... >::value,
+            "Record field types must be trivially copyable");
+
+    using schema = type_tuple<T...>;
+
+    static constexpr ::std::size_t field_count  = sizeof ... (T);
+    static constexpr ::std::size_t alignment    = max_of_v< ::std::size_t, alignof(T)... >;
+private:
+    static constexpr ::std::size_t
+    offset_of(::std::size_t field) noexcept
+    {
+        ::std::size_t const aligns[]{ alignof(T)..., alignment };
+        return detail::field_offsets<sizeof(T)...>::offset(field, aligns);
+    }
+    static constexpr ::std::uint64_t
+    compute_hash() noexcept
+    {
+        ::std::uint64_t const kinds[]{ detail::field_kind<T>()... };
+        ::std::size_t const sizes[]{ sizeof(T)... };
+        ::std::size_t const aligns[]{ alignof(T)... };
+        auto hash = detail::fnv1a_append(detail::fnv1a_offset_basis, field_count);
+        for (::std::size_t i = 0; i < field_count; ++i) {
+            hash = detail::fnv1a_append(hash, kinds[i], 1);
+            hash = detail::fnv1a_append(hash, sizes[i]);
+            hash = detail::fnv1a_append(hash, aligns[i]);
+            hash = detail::fnv1a_append(hash, offset_of(i));
+        }
+        return detail::fnv1a_append(hash, offset_of(field_count));
+    }
+public:
+    template < ::std::size_t I >
+    using field_type    = typename schema::template type<I>;
+
+    template < ::std::size_t I >
+    static constexpr ::std::size_t field_size   = sizeof(field_type<I>);
+    template < ::std::size_t I >
+    static constexpr ::std::size_t field_align  = alignof(field_type<I>);
+    template < ::std::size_t I >
+    static constexpr ::std::size_t offset       = offset_of(I);
+
+    /**
+     * Size of a record including the trailing padding, the stride of an
+     * array of records.
+     */
+    static constexpr ::std::size_t size         = offset_of(field_count);
+    static constexpr ::std::uint64_t schema_hash = compute_hash();
+};
+
+}  /* namespace meta */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_META_RECORD_LAYOUT_HPP_ */
@@ -0,0 +1,131 @@
+/*
+ * static_for.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_META_STATIC_FOR_HPP_
+#define PUSHKIN_META_STATIC_FOR_HPP_
+
+#include <pushkin/meta/type_tuple.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace psst {
+namespace meta {
+
+namespace detail {
+
+template < typename Sequence >
+struct static_for_impl;
+
+template < typename ... T >
+struct static_for_impl< type_tuple<T...> > {
+    template < typename Func >
+    static void
+    call(Func& func)
+    {
+        (void)::std::initializer_list<int>{ (func(type_c<T>), void(), 0)... };
+    }
+};
+
+template < typename T, T ... Values >
+struct static_for_impl< ::std::integer_sequence<T, Values...> > {
+    template < typename Func >
+    static void
+    call(Func& func)
+    {
+        (void)::std::initializer_list<int>{
+            (func(::std::integral_constant<T, Values>{}), void(), 0)... };
+    }
+};
+
+template < typename Tuple, typename Func, ::std::size_t ... Indexes >
+void
+for_each_impl(Tuple&& tuple, Func& func, ::std::index_sequence<Indexes...> const&)
+{
+    using ::std::get;
+    (void)::std::initializer_list<int>{
+        (func(get<Indexes>(::std::forward<Tuple>(tuple))), void(), 0)... };
+}
+
+template < typename Func, ::std::size_t ... Indexes >
+void
+unroll_block(::std::size_t base, Func& func, ::std::index_sequence<Indexes...> const&)
+{
+    (void)base;
+    (void)::std::initializer_list<int>{ (func(base + Indexes), void(), 0)... };
+}
+
+}  /* namespace detail */
+
+/**
+ * Call a function for each element of a compile-time sequence, in order.
+ * The calls are expanded in place, there is no recursive instantiation.
+ *
+ * For a type_tuple the function is called with type_c<T> for each type,
+ * for a ::std::integer_sequence with an ::std::integral_constant for each
+ * value.
+ *
+ * Usage:
+ * @code
+ * static_for< type_tuple<int, double> >([&](auto t) {
+ *     using type = typename decltype(t)::type;
+ *     register_type<type>();
+ * });
+ * static_for< ::std::make_index_sequence<3> >([&](auto i) {
+ *     ::std::get<i.value>(tuple) = 0;
+ * });
+ * @endcode
+ */
+template < typename Sequence, typename Func >
+void
+static_for(Func&& func)
+{
+    detail::static_for_impl<Sequence>::call(func);
+}
+
+/**
+ * Call a function for each element of a tuple-like object (::std::tuple,
+ * ::std::pair, ::std::array), in order.
+ */
+template < typename Tuple, typename Func >
+void
+for_each(Tuple&& tuple, Func&& func)
+{
+    detail::for_each_impl(::std::forward<Tuple>(tuple), func,
+            ::std::make_index_sequence<
+                ::std::tuple_size< ::std::decay_t<Tuple> >::value >{});
+}
+
+/**
+ * Call a function with indexes [0, N) in order.
+ * If N is not greater than Chunk the loop is expanded completely,
+ * otherwise the loop body is expanded Chunk times per iteration and the
+ * remainder is expanded after the loop.
+ *
+ * Usage:
+ * @code
+ * unroll<16, 4>([&](::std::size_t i) { acc[i % 4] += a[i] * b[i]; });
+ * @endcode
+ */
+template < ::std::size_t N, ::std::size_t Chunk = 8, typename Func >
+void
+unroll(Func&& func)
+{
+    static_assert(Chunk > 0, "Chunk size must be positive");
+    constexpr ::std::size_t full = N - N % Chunk;
+    for (::std::size_t base = 0; base < full; base += Chunk)
+        detail::unroll_block(base, func, ::std::make_index_sequence<Chunk>{});
+    detail::unroll_block(full, func, ::std::make_index_sequence<N % Chunk>{});
+}
+
+}  /* namespace meta */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_META_STATIC_FOR_HPP_ */
@@ -0,0 +1,103 @@
+/*
+ * table.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_META_TABLE_HPP_
+#define PUSHKIN_META_TABLE_HPP_
+
+#include <pushkin/meta/integer_sequence.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace psst {
+namespace meta {
+
+namespace detail {
+
+template < typename Generator, typename ... Index >
+using table_value_t = ::std::decay_t<
+        decltype(::std::declval<Generator const&>()(::std::declval<Index>()...)) >;
+
+template < typename Generator, ::std::size_t ... I >
+constexpr ::std::array< table_value_t<Generator, ::std::size_t>, sizeof ... (I) >
+make_table_impl(::std::index_sequence<I...> const&)
+{
+    return {{ Generator{}(I)... }};
+}
+
+template < typename Generator, ::std::size_t Row, ::std::size_t ... J >
+constexpr ::std::array<
+        table_value_t<Generator, ::std::size_t, ::std::size_t>, sizeof ... (J) >
+make_table_row(::std::index_sequence<J...> const&)
+{
+    return {{ Generator{}(Row, J)... }};
+}
+
+template < typename Generator, ::std::size_t M, ::std::size_t ... I >
+constexpr ::std::array<
+        ::std::array< table_value_t<Generator, ::std::size_t, ::std::size_t>, M >,
+        sizeof ... (I) >
+make_table_2d_impl(::std::index_sequence<I...> const&)
+{
+    return {{ make_table_row<Generator, I>(make_index_sequence<0, M - 1>{})... }};
+}
+
+}  /* namespace detail */
+
+/**
+ * Build a lookup table at compile time.
+ * Generator is a default constructible type with a constexpr call
+ * operator, that is called with each index in [0, N).
+ *
+ * Usage:
+ * @code
+ * struct square {
+ *     constexpr int operator()(::std::size_t i) const { return i * i; }
+ * };
+ * constexpr auto squares = make_table<16, square>();
+ * @endcode
+ */
+template < ::std::size_t N, typename Generator >
+constexpr ::std::array< detail::table_value_t<Generator, ::std::size_t>, N >
+make_table()
+{
+    static_assert(N > 0, "Table must not be empty");
+    return detail::make_table_impl<Generator>(make_index_sequence<0, N - 1>{});
+}
+
+/**
+ * Build a two-dimensional lookup table at compile time.
+ * The generator is called with each row and column index, rows are in
+ * [0, N), columns are in [0, M).
+ */
+template < ::std::size_t N, ::std::size_t M, typename Generator >
+constexpr ::std::array<
+        ::std::array< detail::table_value_t<Generator, ::std::size_t, ::std::size_t>, M >, N >
+make_table()
+{
+    static_assert(N > 0 && M > 0, "Table must not be empty");
+    return detail::make_table_2d_impl<Generator, M>(make_index_sequence<0, N - 1>{});
+}
+
+//@{
+/**
+ * Lookup tables as constexpr variables, they are placed in the read-only
+ * data section.
+ */
+template < ::std::size_t N, typename Generator >
+constexpr auto table_v = make_table<N, Generator>();
+
+template < ::std::size_t N, ::std::size_t M, typename Generator >
+constexpr auto table_2d_v = make_table<N, M, Generator>();
+//@}
+
+}  /* namespace meta */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_META_TABLE_HPP_ */
@@ -0,0 +1,104 @@
+/*
+ * type_id.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_META_TYPE_ID_HPP_
+#define PUSHKIN_META_TYPE_ID_HPP_
+
+#include <pushkin/meta/algorithm.hpp>
+#include <pushkin/util/type_name.hpp>
+
+#include <cstdint>
+
+namespace psst {
+namespace meta {
+
+//@{
+/**
+ * Dense type id of a type in a type universe, that is the index of the
+ * type in the type tuple. Ids are in range [0, Universe::size), so they
+ * can be used to index arrays instead of hashing type keys.
+ *
+ * Usage:
+ * @code
+ * using messages = type_tuple<ping, pong, data>;
+ * ::std::array<handler, messages::size> handlers;
+ * handlers[dense_type_id_v<pong, messages>] = ...;
+ * @endcode
+ */
+template < typename T, typename Universe >
+struct dense_type_id;
+
+template < typename T, typename ... Y >
+struct dense_type_id< T, type_tuple<Y...> > : index_of_t< T, Y... > {
+    static_assert(index_of< T, Y... >::found, "Type is not in the type universe");
+};
+
+template < typename T, typename Universe >
+constexpr ::std::size_t dense_type_id_v = dense_type_id<T, Universe>::value;
+//@}
+
+namespace detail {
+
+constexpr ::std::uint64_t fnv1a_offset_basis    = 0xcbf29ce484222325ull;
+constexpr ::std::uint64_t fnv1a_prime           = 0x100000001b3ull;
+
+/**
+ * Append bytes of an integer value to a FNV-1a hash, least significant
+ * byte first
+ */
+constexpr ::std::uint64_t
+fnv1a_append(::std::uint64_t hash, ::std::uint64_t value,
+        ::std::size_t bytes = sizeof(::std::uint64_t)) noexcept
+{
+    for (::std::size_t i = 0; i < bytes; ++i) {
+        hash ^= (value >> (i * 8)) & 0xff;
+        hash *= fnv1a_prime;
+    }
+    return hash;
+}
+
+#if __cplusplus >= 201703L
+constexpr ::std::uint64_t
+fnv1a_hash(::std::string_view str) noexcept
+{
+    ::std::uint64_t hash = fnv1a_offset_basis;
+    for (auto c : str) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= fnv1a_prime;
+    }
+    return hash;
+}
+#endif /* __cplusplus >= 201703L */
+
+}  /* namespace detail */
+
+#if __cplusplus >= 201703L
+
+//@{
+/**
+ * Compile-time 64-bit type id, FNV-1a hash of the normalized type name.
+ * Doesn't need RTTI. The id of a type is the same in all translation
+ * units and shared objects, and across builds with compilers that spell
+ * the type name the same way (see util::type_name).
+ *
+ * Can be used as a template argument or a switch label.
+ */
+template < typename T >
+struct type_id
+    : ::std::integral_constant< ::std::uint64_t,
+        detail::fnv1a_hash(util::type_name<T>()) > {};
+
+template < typename T >
+constexpr ::std::uint64_t type_id_v = type_id<T>::value;
+//@}
+
+#endif /* __cplusplus >= 201703L */
+
+}  /* namespace meta */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_META_TYPE_ID_HPP_ */
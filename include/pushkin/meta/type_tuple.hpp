@@ -26,6 +26,22 @@ struct type_tuple<> {
     static constexpr ::std::size_t size = 0;
 };
 
+/**
+ * A value representing a type, to pass types to generic lambdas
+ *
+ * Usage:
+ * @code
+ * auto f = [](auto t) { using type = typename decltype(t)::type; };
+ * f(type_c<int>);
+ * @endcode
+ */
+template < typename T >
+struct type_constant {
+    using type = T;
+};
+template < typename T >
+constexpr type_constant<T> type_c{};
+
 template < typename T >
 struct to_std_tuple {
     using type = ::std::tuple< T >;
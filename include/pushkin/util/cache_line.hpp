@@ -0,0 +1,24 @@
+/*
+ * cache_line.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_CACHE_LINE_HPP_
+#define PUSHKIN_UTIL_CACHE_LINE_HPP_
+
+#include <cstddef>
+
+namespace psst {
+namespace util {
+
+/**
+ * Size used to separate data modified by different threads
+ */
+constexpr ::std::size_t cache_line_size = 64;
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_CACHE_LINE_HPP_ */
@@ -0,0 +1,382 @@
+/*
+ * compact_variant.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_COMPACT_VARIANT_HPP_
+#define PUSHKIN_UTIL_COMPACT_VARIANT_HPP_
+
+#include <pushkin/meta/type_id.hpp>
+#include <pushkin/meta/integer_sequence.hpp>
+#include <pushkin/util/construct.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace psst {
+namespace util {
+
+/**
+ * Trait to mark types that can be moved to another place in memory with
+ * memcpy without calling the move constructor and the destructor.
+ * Specialize for types that are not trivially copyable but still can be
+ * relocated, e.g. types holding a unique_ptr.
+ */
+template < typename T >
+struct is_trivially_relocatable : ::std::is_trivially_copyable<T> {};
+
+/**
+ * Exception thrown when a compact_variant is accessed as a wrong type or
+ * a valueless compact_variant is visited.
+ */
+class bad_variant_access : public ::std::exception {
+public:
+    char const*
+    what() const noexcept override
+    { return "bad compact_variant access"; }
+};
+
+template < typename Types, bool TriviallyRelocatable = false >
+class compact_variant;
+
+namespace detail {
+
+template < typename T, typename Ptr >
+struct variant_ref {
+    using type = T&;
+};
+
+template < typename T >
+struct variant_ref< T, void const* > {
+    using type = T const&;
+};
+
+template < typename Visitor, typename T, typename Ptr >
+struct variant_visit_thunk {
+    using ref_type      = typename variant_ref<T, Ptr>::type;
+    using result_type   = decltype(::std::declval<Visitor&>()(::std::declval<ref_type>()));
+
+    static result_type
+    call(Visitor& visitor, Ptr storage)
+    {
+        return visitor(*static_cast< ::std::remove_reference_t<ref_type>* >(storage));
+    }
+};
+
+}  /* namespace detail */
+
+/**
+ * Variant type with the smallest possible discriminator.
+ *
+ * The discriminator is the smallest unsigned type that can hold
+ * [0, size], the value `size` is reserved for the valueless state.
+ * Storage is sized and aligned for the largest alternative, and all
+ * operations that depend on the type of the value go through constexpr
+ * tables of function pointers indexed by the discriminator.
+ *
+ * Alternatives are matched exactly, there are no converting
+ * constructors. A default constructed variant is valueless.
+ *
+ * If TriviallyRelocatable is true, all alternatives must satisfy
+ * is_trivially_relocatable, moving the variant copies the bytes and
+ * leaves the source valueless, and the variant itself is marked trivially
+ * relocatable, so that containers can memcpy it.
+ *
+ * Usage:
+ * @code
+ * using message = compact_variant< type_tuple<order, cancel, heartbeat> >;
+ * message msg{ order{ 1, 10.5 } };
+ * msg.visit([](auto const& m) { handle(m); });
+ * @endcode
+ */
+template < typename ... T, bool TriviallyRelocatable >
+class compact_variant< meta::type_tuple<T...>, TriviallyRelocatable > {
+public:
+    using types     = meta::type_tuple<T...>;
+    static_assert(types::size > 0, "Variant must have at least one alternative");
+    static_assert(meta::unique_t<types>::size == types::size,
+            "Variant alternatives must be unique");
+    static_assert(!TriviallyRelocatable ||
+            meta::all_match< is_trivially_relocatable, T... >::value,
+            "All alternatives of a trivially relocatable variant must be trivially relocatable");
+
+    static constexpr ::std::size_t size           = types::size;
+    static constexpr ::std::size_t storage_size   = meta::max_of_v< ::std::size_t, sizeof(T)... >;
+    static constexpr ::std::size_t storage_align  = meta::max_of_v< ::std::size_t, alignof(T)... >;
+    static constexpr bool trivially_relocatable  = TriviallyRelocatable;
+
+    using index_type = meta::smallest_unsigned_t<size>;
+    static constexpr index_type npos = static_cast<index_type>(size);
+
+    template < typename U >
+    static constexpr index_type index_of = static_cast<index_type>(
+            meta::dense_type_id_v<U, types>);
+public:
+    compact_variant() noexcept
+        : storage_{}, index_{npos} {}
+
+    template < typename U,
+        typename = ::std::enable_if_t<
+                meta::contains< ::std::decay_t<U>, types >::value > >
+    compact_variant(U&& value)
+        : storage_{}, index_{npos}
+    {
+        emplace< ::std::decay_t<U> >(::std::forward<U>(value));
+    }
+
+    compact_variant(compact_variant const& rhs)
+        : storage_{}, index_{npos}
+    {
+        copy_from(rhs);
+    }
+    compact_variant(compact_variant&& rhs)
+            noexcept(TriviallyRelocatable || all_nothrow_move)
+        : storage_{}, index_{npos}
+    {
+        move_from(rhs);
+    }
+    ~compact_variant()
+    {
+        reset();
+    }
+
+    compact_variant&
+    operator = (compact_variant const& rhs)
+    {
+        if (this != &rhs) {
+            reset();
+            copy_from(rhs);
+        }
+        return *this;
+    }
+    compact_variant&
+    operator = (compact_variant&& rhs)
+            noexcept(TriviallyRelocatable || all_nothrow_move)
+    {
+        if (this != &rhs) {
+            reset();
+            move_from(rhs);
+        }
+        return *this;
+    }
+    template < typename U,
+        typename = ::std::enable_if_t<
+                meta::contains< ::std::decay_t<U>, types >::value > >
+    compact_variant&
+    operator = (U&& value)
+    {
+        emplace< ::std::decay_t<U> >(::std::forward<U>(value));
+        return *this;
+    }
+
+    /**
+     * Destroy the current value and construct a value of type U.
+     * If the constructor throws, the variant is left valueless.
+     */
+    template < typename U, typename ... Args >
+    U&
+    emplace(Args&& ... args)
+    {
+        reset();
+        auto* value = construct_in_place<U>(storage_.data, ::std::forward<Args>(args)...);
+        index_ = index_of<U>;
+        return *value;
+    }
+
+    /**
+     * Destroy the current value and make the variant valueless
+     */
+    void
+    reset() noexcept
+    {
+        if (index_ != npos) {
+            if (!all_trivially_destructible)
+                destroy_table()[index_](storage_.data);
+            index_ = npos;
+        }
+    }
+
+    index_type
+    index() const noexcept
+    { return index_; }
+    bool
+    valueless() const noexcept
+    { return index_ == npos; }
+    template < typename U >
+    bool
+    holds() const noexcept
+    { return index_ == index_of<U>; }
+
+    template < typename U >
+    U*
+    get_if() noexcept
+    { return holds<U>() ? reinterpret_cast<U*>(storage_.data) : nullptr; }
+    template < typename U >
+    U const*
+    get_if() const noexcept
+    { return holds<U>() ? reinterpret_cast<U const*>(storage_.data) : nullptr; }
+
+    /**
+     * Access the value as type U
+     * @throws bad_variant_access if the variant doesn't hold a value of type U
+     */
+    template < typename U >
+    U&
+    get()
+    {
+        if (!holds<U>())
+            throw bad_variant_access{};
+        return *reinterpret_cast<U*>(storage_.data);
+    }
+    template < typename U >
+    U const&
+    get() const
+    {
+        if (!holds<U>())
+            throw bad_variant_access{};
+        return *reinterpret_cast<U const*>(storage_.data);
+    }
+
+    /**
+     * Call the visitor with a reference to the current value. The
+     * visitor must be callable with every alternative and return the
+     * same type for all of them.
+     * @throws bad_variant_access if the variant is valueless
+     */
+    template < typename Visitor >
+    decltype(auto)
+    visit(Visitor&& visitor)
+    {
+        return visit_impl<void*>(visitor, storage_.data);
+    }
+    template < typename Visitor >
+    decltype(auto)
+    visit(Visitor&& visitor) const
+    {
+        return visit_impl<void const*>(visitor, storage_.data);
+    }
+private:
+    static constexpr bool all_trivially_destructible =
+            meta::all_match< ::std::is_trivially_destructible, T... >::value;
+    static constexpr bool all_trivially_copyable =
+            meta::all_match< ::std::is_trivially_copyable, T... >::value;
+    static constexpr bool all_nothrow_move =
+            meta::all_match< ::std::is_nothrow_move_constructible, T... >::value;
+
+    using destroy_type  = void(*)(void*);
+    using copy_type     = void(*)(void*, void const*);
+    using move_type     = void(*)(void*, void*);
+
+    template < typename U >
+    static void
+    destroy_impl(void* value) noexcept
+    { static_cast<U*>(value)->~U(); }
+    template < typename U >
+    static void
+    copy_impl(void* dst, void const* src)
+    { construct_in_place<U>(dst, *static_cast<U const*>(src)); }
+    template < typename U >
+    static void
+    move_impl(void* dst, void* src)
+    { construct_in_place<U>(dst, ::std::move(*static_cast<U*>(src))); }
+
+    static destroy_type const*
+    destroy_table() noexcept
+    {
+        static constexpr destroy_type table[]{ &destroy_impl<T>... };
+        return table;
+    }
+    static copy_type const*
+    copy_table() noexcept
+    {
+        static constexpr copy_type table[]{ &copy_impl<T>... };
+        return table;
+    }
+    static move_type const*
+    move_table() noexcept
+    {
+        static constexpr move_type table[]{ &move_impl<T>... };
+        return table;
+    }
+
+    template < typename Ptr, typename Visitor >
+    decltype(auto)
+    visit_impl(Visitor& visitor, Ptr storage) const
+    {
+        using front_thunk   = detail::variant_visit_thunk<Visitor, meta::front_t<T...>, Ptr>;
+        using result_type   = typename front_thunk::result_type;
+        using thunk_type    = result_type(*)(Visitor&, Ptr);
+        static constexpr thunk_type table[]{
+            &detail::variant_visit_thunk<Visitor, T, Ptr>::call... };
+        if (index_ == npos)
+            throw bad_variant_access{};
+        return table[index_](visitor, storage);
+    }
+
+    void
+    copy_from(compact_variant const& rhs)
+    {
+        if (rhs.index_ == npos)
+            return;
+        if (all_trivially_copyable)
+            ::std::memcpy(storage_.data, rhs.storage_.data, storage_size);
+        else
+            copy_table()[rhs.index_](storage_.data, rhs.storage_.data);
+        index_ = rhs.index_;
+    }
+    void
+    move_from(compact_variant& rhs)
+    {
+        if (rhs.index_ == npos)
+            return;
+        if (TriviallyRelocatable || all_trivially_copyable) {
+            ::std::memcpy(storage_.data, rhs.storage_.data, storage_size);
+            index_ = rhs.index_;
+            if (TriviallyRelocatable)
+                rhs.index_ = npos;
+        } else {
+            move_table()[rhs.index_](storage_.data, rhs.storage_.data);
+            index_ = rhs.index_;
+        }
+    }
+
+    union storage_type {
+        storage_type() noexcept : none{} {}
+
+        char                                    none;
+        alignas(storage_align) unsigned char    data[storage_size];
+    };
+
+    storage_type    storage_;
+    index_type      index_;
+};
+
+/**
+ * Visit a compact_variant
+ */
+template < typename Visitor, typename Types, bool TriviallyRelocatable >
+decltype(auto)
+visit(Visitor&& visitor, compact_variant<Types, TriviallyRelocatable>& var)
+{
+    return var.visit(::std::forward<Visitor>(visitor));
+}
+template < typename Visitor, typename Types, bool TriviallyRelocatable >
+decltype(auto)
+visit(Visitor&& visitor, compact_variant<Types, TriviallyRelocatable> const& var)
+{
+    return var.visit(::std::forward<Visitor>(visitor));
+}
+
+template < typename Types >
+struct is_trivially_relocatable< compact_variant<Types, true> > : ::std::true_type {};
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_COMPACT_VARIANT_HPP_ */
@@ -0,0 +1,53 @@
+/*
+ * construct.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_CONSTRUCT_HPP_
+#define PUSHKIN_UTIL_CONSTRUCT_HPP_
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace psst {
+namespace util {
+
+namespace detail {
+
+template < typename T, typename ... Args >
+T*
+construct_in_place(::std::true_type, void* place, Args&& ... args)
+{
+    return ::new (place) T( ::std::forward<Args>(args)... );
+}
+
+template < typename T, typename ... Args >
+T*
+construct_in_place(::std::false_type, void* place, Args&& ... args)
+{
+    return ::new (place) T{ ::std::forward<Args>(args)... };
+}
+
+}  /* namespace detail */
+
+/**
+ * Construct a value in raw storage. Uses direct initialisation so that
+ * initializer_list constructors are not picked up by accident, falls back
+ * to braces for aggregates.
+ */
+template < typename T, typename ... Args >
+T*
+construct_in_place(void* place, Args&& ... args)
+{
+    return detail::construct_in_place<T>(
+            ::std::is_constructible<T, Args&&...>{},
+            place, ::std::forward<Args>(args)...);
+}
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_CONSTRUCT_HPP_ */
@@ -0,0 +1,113 @@
+/*
+ * crc32.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_CRC32_HPP_
+#define PUSHKIN_UTIL_CRC32_HPP_
+
+#include <pushkin/meta/table.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace psst {
+namespace util {
+
+/** Reflected polynomial of CRC-32 (IEEE 802.3, zlib) */
+constexpr ::std::uint32_t crc32_ieee_polynomial = 0xedb88320u;
+/** Reflected polynomial of CRC-32C (Castagnoli, iSCSI, SSE4.2) */
+constexpr ::std::uint32_t crc32c_polynomial     = 0x82f63b78u;
+
+/**
+ * Generator of slicing-by-8 tables for a reflected CRC-32 polynomial.
+ * Slice 0 is the classic byte-wise table, slice k is the CRC of a byte
+ * followed by k zero bytes.
+ */
+template < ::std::uint32_t Polynomial >
+struct crc32_table_generator {
+    static constexpr ::std::uint32_t
+    byte_crc(::std::uint32_t crc) noexcept
+    {
+        for (auto i = 0; i < 8; ++i)
+            crc = (crc & 1) ? (crc >> 1) ^ Polynomial : crc >> 1;
+        return crc;
+    }
+
+    constexpr ::std::uint32_t
+    operator()(::std::size_t slice, ::std::size_t byte) const noexcept
+    {
+        auto crc = byte_crc(static_cast<::std::uint32_t>(byte));
+        for (::std::size_t i = 0; i < slice; ++i)
+            crc = (crc >> 8) ^ byte_crc(crc & 0xff);
+        return crc;
+    }
+};
+
+static_assert(crc32_table_generator<crc32_ieee_polynomial>{}(0, 1) == 0x77073096u,
+        "Invalid CRC-32 table");
+static_assert(crc32_table_generator<crc32_ieee_polynomial>{}(0, 255) == 0x2d02ef8du,
+        "Invalid CRC-32 table");
+static_assert(crc32_table_generator<crc32c_polynomial>{}(0, 1) == 0xf26b8303u,
+        "Invalid CRC-32C table");
+static_assert(crc32_table_generator<crc32c_polynomial>{}(0, 255) == 0xad7d5351u,
+        "Invalid CRC-32C table");
+
+using crc32_tables_type = ::std::array< ::std::array<::std::uint32_t, 256>, 8 >;
+
+/**
+ * Slicing-by-8 tables for a polynomial, generated at compile time
+ */
+template < ::std::uint32_t Polynomial >
+crc32_tables_type const&
+crc32_tables() noexcept
+{
+    static constexpr crc32_tables_type tables
+            = meta::make_table< 8, 256, crc32_table_generator<Polynomial> >();
+    return tables;
+}
+
+/**
+ * Calculate a reflected CRC-32 with a slicing-by-8 algorithm.
+ * @param crc CRC of the preceding data to continue a calculation
+ */
+template < ::std::uint32_t Polynomial >
+::std::uint32_t
+crc32(void const* data, ::std::size_t size, ::std::uint32_t crc = 0) noexcept
+{
+    auto const& t = crc32_tables<Polynomial>();
+    auto p = static_cast<unsigned char const*>(data);
+    auto read32 = [](unsigned char const* b) {
+        return ::std::uint32_t{b[0]} | ::std::uint32_t{b[1]} << 8
+            | ::std::uint32_t{b[2]} << 16 | ::std::uint32_t{b[3]} << 24;
+    };
+    crc = ~crc;
+    for (; size >= 8; size -= 8, p += 8) {
+        auto lo = read32(p) ^ crc;
+        auto hi = read32(p + 4);
+        crc = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff]
+            ^ t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24]
+            ^ t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff]
+            ^ t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+    }
+    for (; size > 0; --size, ++p)
+        crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xff];
+    return ~crc;
+}
+
+/**
+ * Calculate CRC-32C (Castagnoli)
+ */
+inline ::std::uint32_t
+crc32c(void const* data, ::std::size_t size, ::std::uint32_t crc = 0) noexcept
+{
+    return crc32<crc32c_polynomial>(data, size, crc);
+}
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_CRC32_HPP_ */
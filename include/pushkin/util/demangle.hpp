@@ -8,9 +8,12 @@
 #ifndef PUSHKIN_UTIL_DEMANGLE_HPP_
 #define PUSHKIN_UTIL_DEMANGLE_HPP_
 
+#include <pushkin/util/type_name.hpp>
+
 #include <string>
-#include <iosfwd>
+#include <ostream>
 
+#if __cplusplus < 201703L
 /*
  * Test for non-portable GNU extension compatibility.
  */
@@ -25,10 +28,46 @@
 #ifdef HAS_GNU_EXTENSIONS_
 #include <cxxabi.h>
 #endif
+#endif /* __cplusplus < 201703L */
 
 namespace psst {
 namespace util {
 
+#if __cplusplus >= 201703L
+
+/**
+ * Type name demangle function, built on the compile-time type_name,
+ * doesn't need RTTI.
+ * Usage:
+ * @code
+ * ::std::cout << demangle< ::std::iostream >() << "\n"
+ * @endcode
+ * @return Demangled type name
+ */
+template < typename T >
+::std::string
+demangle()
+{
+    return ::std::string{ type_name<T>() };
+}
+
+/**
+ * Type name demangle function, io manip interface. Doesn't create a string.
+ * Usage:
+ * @code
+ * demangle< ::std::iostream >(::std::cout);
+ * @endcode
+ * @param os
+ */
+template < typename T >
+void
+demangle(::std::ostream& os)
+{
+    os << type_name<T>();
+}
+
+#else
+
 /**
  * Type name demangle function
  * Usage:
@@ -66,7 +105,7 @@ demangle()
  */
 template < typename T >
 void
-demangle(::std::iostream& os)
+demangle(::std::ostream& os)
 {
     ::std::ostream::sentry s(os);
     if (s) {
@@ -87,6 +126,8 @@ demangle(::std::iostream& os)
     }
 }
 
+#endif /* __cplusplus >= 201703L */
+
 }  /* namespace util */
 }  /* namespace psst */
 
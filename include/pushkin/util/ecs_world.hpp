@@ -0,0 +1,595 @@
+/*
+ * ecs_world.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_ECS_WORLD_HPP_
+#define PUSHKIN_UTIL_ECS_WORLD_HPP_
+
+#include <pushkin/meta/algorithm.hpp>
+#include <pushkin/meta/type_id.hpp>
+#include <pushkin/util/type_bitset.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace psst {
+namespace util {
+
+/**
+ * Entity handle, the generation tells a destroyed entity from a new one
+ * reusing the same index
+ */
+struct entity {
+    ::std::uint32_t index;
+    ::std::uint32_t generation;
+
+    constexpr bool
+    operator == (entity const& rhs) const noexcept
+    { return index == rhs.index && generation == rhs.generation; }
+    constexpr bool
+    operator != (entity const& rhs) const noexcept
+    { return !(*this == rhs); }
+};
+
+namespace detail {
+
+/**
+ * Order of components by their index in the component universe
+ */
+template < typename Universe >
+struct component_order {
+    template < typename A, typename B >
+    using less = ::std::integral_constant< bool,
+            (meta::dense_type_id_v<A, Universe> < meta::dense_type_id_v<B, Universe>) >;
+};
+
+template < typename Universe, typename ... T >
+constexpr bool
+all_components_known() noexcept
+{
+    bool const found[]{ meta::index_of<T, Universe>::found..., true };
+    bool res = true;
+    for (auto f : found)
+        res = res && f;
+    return res;
+}
+
+class component_column_base {
+public:
+    virtual ~component_column_base() = default;
+
+    /**
+     * Move a value from the row of another column of the same type to the
+     * end of this column
+     */
+    virtual void
+    move_back_from(component_column_base& src, ::std::size_t row) = 0;
+    /**
+     * Remove a value moving the last value to its place
+     */
+    virtual void
+    swap_remove(::std::size_t row) = 0;
+    /**
+     * Destroy values at the end of the column so that it has size values
+     */
+    virtual void
+    truncate(::std::size_t size) noexcept = 0;
+};
+
+template < typename T >
+class component_column : public component_column_base {
+public:
+    component_column() : values{} {}
+
+    void
+    move_back_from(component_column_base& src, ::std::size_t row) override
+    {
+        values.push_back(::std::move(static_cast<component_column&>(src).values[row]));
+    }
+    void
+    swap_remove(::std::size_t row) override
+    {
+        if (row + 1 != values.size())
+            values[row] = ::std::move(values.back());
+        values.pop_back();
+    }
+    void
+    truncate(::std::size_t size) noexcept override
+    {
+        while (values.size() > size)
+            values.pop_back();
+    }
+
+    ::std::vector<T> values;
+};
+
+using column_factory = ::std::unique_ptr<component_column_base>(*)();
+
+template < typename T >
+::std::unique_ptr<component_column_base>
+make_component_column()
+{
+    return ::std::unique_ptr<component_column_base>{ new component_column<T>{} };
+}
+
+}  /* namespace detail */
+
+/**
+ * Entities of an archetype, that is with the same set of components.
+ * Components are stored in a column per component type, a row per entity.
+ */
+template < typename Universe >
+class archetype {
+public:
+    using mask_type = type_bitset<Universe>;
+public:
+    archetype(mask_type const& mask, detail::column_factory const* factories)
+        : mask_{mask}, entities_{}, columns_{}
+    {
+        for (::std::size_t i = 0; i < Universe::size; ++i) {
+            if (mask_.test(i))
+                columns_[i] = factories[i]();
+        }
+    }
+
+    mask_type const&
+    mask() const noexcept
+    { return mask_; }
+    ::std::size_t
+    size() const noexcept
+    { return entities_.size(); }
+    bool
+    empty() const noexcept
+    { return entities_.empty(); }
+
+    entity const*
+    entities() const noexcept
+    { return entities_.data(); }
+    /**
+     * Column of a component, the component must be in the archetype
+     */
+    template < typename T >
+    ::std::vector<T>&
+    column() noexcept
+    {
+        return static_cast< detail::component_column<T>& >(
+                *columns_[meta::dense_type_id_v<T, Universe>]).values;
+    }
+    template < typename T >
+    T*
+    data() noexcept
+    { return column<T>().data(); }
+private:
+    template < typename U >
+    friend class ecs_world;
+
+    /**
+     * Append an entity, the caller has appended the components
+     */
+    void
+    push_entity(entity e)
+    {
+        try {
+            entities_.push_back(e);
+        } catch (...) {
+            truncate(entities_.size());
+            throw;
+        }
+    }
+    /**
+     * Roll back components appended for a row that wasn't added
+     */
+    void
+    truncate(::std::size_t size) noexcept
+    {
+        for (auto& column : columns_) {
+            if (column)
+                column->truncate(size);
+        }
+    }
+    /**
+     * Move the components of a row to another archetype. Components
+     * missing in the other archetype are left for swap_remove.
+     */
+    void
+    move_row_to(archetype& dst, ::std::size_t row)
+    {
+        for (::std::size_t i = 0; i < Universe::size; ++i) {
+            if (columns_[i] && dst.columns_[i])
+                dst.columns_[i]->move_back_from(*columns_[i], row);
+        }
+    }
+    /**
+     * Remove a row, the last row is moved in its place
+     * @return The entity moved to the row
+     */
+    entity
+    swap_remove(::std::size_t row)
+    {
+        for (auto& column : columns_) {
+            if (column)
+                column->swap_remove(row);
+        }
+        entities_[row] = entities_.back();
+        entities_.pop_back();
+        return row < entities_.size() ? entities_[row] : entity{};
+    }
+
+    using column_ptr = ::std::unique_ptr<detail::component_column_base>;
+
+    mask_type                                   mask_;
+    ::std::vector<entity>                       entities_;
+    ::std::array< column_ptr, Universe::size >  columns_;
+};
+
+template < typename World, typename Read, typename Exclude >
+class ecs_query;
+
+template < typename Universe >
+class ecs_world;
+
+/**
+ * Entity component store, entities with the same set of components share
+ * an archetype and components are stored in columns of archetypes. The
+ * components are listed in the Universe type tuple.
+ *
+ * Usage:
+ * @code
+ * using world_type = ecs_world< type_tuple<position, velocity, sleeping> >;
+ * world_type world;
+ * auto e = world.create(position{}, velocity{ 1, 0 });
+ *
+ * world_type::query< type_tuple<position, velocity>, type_tuple<sleeping> > moving{ world };
+ * moving.each([](position& p, velocity const& v) { p.x += v.x; });
+ * @endcode
+ */
+template < typename ... C >
+class ecs_world< meta::type_tuple<C...> > {
+public:
+    using components        = meta::type_tuple<C...>;
+    using mask_type         = type_bitset<components>;
+    using archetype_type    = archetype<components>;
+
+    /**
+     * Canonical archetype for a set of components: unique components in
+     * the order of the universe
+     */
+    template < typename ... T >
+    using archetype_of_t    = meta::stable_sort_t<
+            detail::component_order<components>::template less, meta::unique_t<T...> >;
+
+    template < typename Read, typename Exclude = meta::type_tuple<> >
+    using query             = ecs_query< ecs_world, Read, Exclude >;
+public:
+    ecs_world()
+        : archetypes_{}, records_{}, free_{}, size_{0}
+    {}
+
+    /**
+     * Create an entity with the components
+     */
+    template < typename ... T >
+    entity
+    create(T&& ... values)
+    {
+        using canonical = archetype_of_t< ::std::decay_t<T>... >;
+        static_assert(canonical::size == sizeof ... (T),
+                "Components of an entity must be unique");
+        static_assert(detail::all_components_known< components, ::std::decay_t<T>... >(),
+                "Component is not in the world's component list");
+        auto arch_index = find_archetype(mask_type{ canonical{} });
+        auto& arch = *archetypes_[arch_index];
+        auto row = arch.size();
+        try {
+            (void)::std::initializer_list<int>{
+                (arch.template column< ::std::decay_t<T> >().emplace_back(
+                        ::std::forward<T>(values)), 0)... };
+        } catch (...) {
+            arch.truncate(row);
+            throw;
+        }
+        entity e{ 0, 0 };
+        try {
+            e = allocate();
+        } catch (...) {
+            arch.truncate(row);
+            throw;
+        }
+        try {
+            arch.push_entity(e);
+        } catch (...) {
+            arch.truncate(row);
+            free_.push_back(e.index);
+            throw;
+        }
+        records_[e.index].archetype = arch_index;
+        records_[e.index].row = row;
+        ++size_;
+        return e;
+    }
+    /**
+     * Destroy an entity and its components
+     */
+    void
+    destroy(entity e)
+    {
+        if (!alive(e))
+            return;
+        auto& rec = records_[e.index];
+        remove_row(*archetypes_[rec.archetype], rec.row);
+        rec.archetype = npos;
+        ++rec.generation;
+        free_.push_back(e.index);
+        --size_;
+    }
+    bool
+    alive(entity e) const noexcept
+    {
+        return e.index < records_.size()
+            && records_[e.index].generation == e.generation
+            && records_[e.index].archetype != npos;
+    }
+    /**
+     * Number of live entities
+     */
+    ::std::size_t
+    size() const noexcept
+    { return size_; }
+
+    template < typename T >
+    bool
+    has(entity e) const noexcept
+    {
+        return alive(e)
+            && archetypes_[records_[e.index].archetype]->mask().template has<T>();
+    }
+    /**
+     * Component of an entity
+     * @return Pointer to the component or nullptr if the entity is not
+     *         alive or doesn't have the component
+     */
+    template < typename T >
+    T*
+    get(entity e) noexcept
+    {
+        if (!has<T>(e))
+            return nullptr;
+        auto const& rec = records_[e.index];
+        return archetypes_[rec.archetype]->template data<T>() + rec.row;
+    }
+
+    /**
+     * Add a component to an entity, moving it to another archetype, or
+     * replace the component if the entity has it
+     */
+    template < typename T >
+    void
+    add(entity e, T&& component)
+    {
+        using value_type = ::std::decay_t<T>;
+        if (!alive(e))
+            return;
+        if (auto* current = get<value_type>(e)) {
+            *current = ::std::forward<T>(component);
+            return;
+        }
+        auto src_index = records_[e.index].archetype;
+        auto mask = archetypes_[src_index]->mask();
+        auto dst_index = find_archetype(mask.template insert<value_type>());
+        auto& dst = *archetypes_[dst_index];
+        try {
+            dst.template column<value_type>().emplace_back(::std::forward<T>(component));
+        } catch (...) {
+            dst.truncate(dst.size());
+            throw;
+        }
+        move_entity(e, dst_index);
+    }
+    /**
+     * Remove a component from an entity, moving it to another archetype
+     */
+    template < typename T >
+    void
+    remove(entity e)
+    {
+        if (!has<T>(e))
+            return;
+        auto mask = archetypes_[records_[e.index].archetype]->mask();
+        move_entity(e, find_archetype(mask.template erase<T>()));
+    }
+
+    ::std::size_t
+    archetype_count() const noexcept
+    { return archetypes_.size(); }
+    archetype_type&
+    archetype_at(::std::size_t index) noexcept
+    { return *archetypes_[index]; }
+
+    /**
+     * Call a function for components of all entities that have all of
+     * Read and none of Exclude components
+     */
+    template < typename Read, typename Exclude = meta::type_tuple<>, typename Func >
+    void
+    each(Func&& func)
+    {
+        query<Read, Exclude>{ *this }.each(::std::forward<Func>(func));
+    }
+private:
+    static constexpr ::std::uint32_t npos = ::std::numeric_limits<::std::uint32_t>::max();
+
+    struct entity_record {
+        ::std::uint32_t generation;
+        ::std::uint32_t archetype;
+        ::std::size_t   row;
+    };
+    using archetype_ptr = ::std::unique_ptr<archetype_type>;
+
+    static detail::column_factory const*
+    column_factories() noexcept
+    {
+        static constexpr detail::column_factory factories[]{
+            &detail::make_component_column<C>..., nullptr };
+        return factories;
+    }
+
+    ::std::uint32_t
+    find_archetype(mask_type const& mask)
+    {
+        for (::std::size_t i = 0; i < archetypes_.size(); ++i) {
+            if (archetypes_[i]->mask() == mask)
+                return static_cast<::std::uint32_t>(i);
+        }
+        archetypes_.push_back(::std::make_unique<archetype_type>(mask, column_factories()));
+        return static_cast<::std::uint32_t>(archetypes_.size() - 1);
+    }
+
+    entity
+    allocate()
+    {
+        if (!free_.empty()) {
+            auto index = free_.back();
+            free_.pop_back();
+            return entity{ index, records_[index].generation };
+        }
+        records_.push_back(entity_record{ 0, npos, 0 });
+        return entity{ static_cast<::std::uint32_t>(records_.size() - 1), 0 };
+    }
+
+    void
+    remove_row(archetype_type& arch, ::std::size_t row)
+    {
+        auto moved = arch.swap_remove(row);
+        if (row < arch.size())
+            records_[moved.index].row = row;
+    }
+
+    /**
+     * Move an entity to another archetype, components that the other
+     * archetype has and the current doesn't are already appended
+     */
+    void
+    move_entity(entity e, ::std::uint32_t dst_index)
+    {
+        auto& rec = records_[e.index];
+        auto& src = *archetypes_[rec.archetype];
+        auto& dst = *archetypes_[dst_index];
+        auto row = dst.size();
+        try {
+            src.move_row_to(dst, rec.row);
+            dst.push_entity(e);
+        } catch (...) {
+            dst.truncate(row);
+            throw;
+        }
+        remove_row(src, rec.row);
+        rec.archetype = dst_index;
+        rec.row = row;
+    }
+
+    ::std::vector<archetype_ptr>    archetypes_;
+    ::std::vector<entity_record>    records_;
+    ::std::vector<::std::uint32_t>  free_;
+    ::std::size_t                   size_;
+};
+
+/**
+ * Query of entities that have all of Read and none of Exclude components.
+ * Matching archetypes are found by a mask test and cached, archetypes
+ * created after the last run are checked on the next run. Components are
+ * iterated linearly along the archetype columns.
+ *
+ * Entities must not be created, destroyed or change components while
+ * iterating.
+ */
+template < typename World, typename ... Read, typename ... Exclude >
+class ecs_query< World, meta::type_tuple<Read...>, meta::type_tuple<Exclude...> > {
+public:
+    using world_type    = World;
+    using read_type     = meta::type_tuple<Read...>;
+    using exclude_type  = meta::type_tuple<Exclude...>;
+public:
+    explicit
+    ecs_query(world_type& world)
+        : world_{&world}, matched_{}, checked_{0}
+    {}
+    ecs_query(ecs_query const&) = default;
+    ecs_query&
+    operator = (ecs_query const&) = default;
+
+    /**
+     * Call a function with references to the Read components of each
+     * matching entity
+     */
+    template < typename Func >
+    void
+    each(Func&& func)
+    {
+        update();
+        for (auto index : matched_) {
+            auto& arch = world_->archetype_at(index);
+            each_row(func, arch.size(), arch.template data<Read>()...);
+        }
+    }
+    /**
+     * Call a function with the entity and references to the Read
+     * components of each matching entity
+     */
+    template < typename Func >
+    void
+    each_entity(Func&& func)
+    {
+        update();
+        for (auto index : matched_) {
+            auto& arch = world_->archetype_at(index);
+            each_row(func, arch.size(), arch.entities(), arch.template data<Read>()...);
+        }
+    }
+    /**
+     * Number of matching entities
+     */
+    ::std::size_t
+    size()
+    {
+        update();
+        ::std::size_t res = 0;
+        for (auto index : matched_)
+            res += world_->archetype_at(index).size();
+        return res;
+    }
+private:
+    void
+    update()
+    {
+        for (; checked_ < world_->archetype_count(); ++checked_) {
+            if (world_->archetype_at(checked_).mask().template matches<read_type, exclude_type>())
+                matched_.push_back(checked_);
+        }
+    }
+    template < typename Func, typename ... T >
+    static void
+    each_row(Func& func, ::std::size_t size, T* ... columns)
+    {
+        for (::std::size_t i = 0; i < size; ++i)
+            func(columns[i]...);
+    }
+
+    world_type*                 world_;
+    ::std::vector<::std::size_t> matched_;
+    ::std::size_t               checked_;
+};
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_ECS_WORLD_HPP_ */
@@ -0,0 +1,266 @@
+/*
+ * function_ref.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_FUNCTION_REF_HPP_
+#define PUSHKIN_UTIL_FUNCTION_REF_HPP_
+
+#include <pushkin/meta/function_traits.hpp>
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace psst {
+namespace util {
+
+namespace detail {
+
+template < typename Func, typename ... Args >
+auto
+invoke_callable(Func&& func, Args&& ... args)
+    -> decltype(::std::forward<Func>(func)(::std::forward<Args>(args)...))
+{
+    return ::std::forward<Func>(func)(::std::forward<Args>(args)...);
+}
+
+template < typename Member, typename Class, typename Object, typename ... Args >
+auto
+invoke_callable(Member Class::* func, Object&& obj, Args&& ... args)
+    -> decltype((::std::forward<Object>(obj).*func)(::std::forward<Args>(args)...))
+{
+    return (::std::forward<Object>(obj).*func)(::std::forward<Args>(args)...);
+}
+
+template < typename Return, typename Func, typename ... Args >
+struct is_invocable_r_impl {
+private:
+    template < typename U >
+    static ::std::is_convertible<
+        decltype(invoke_callable(::std::declval<U>(), ::std::declval<Args>()...)), Return >
+    test(void*);
+    template < typename U >
+    static ::std::false_type
+    test(...);
+public:
+    static constexpr bool value = decltype(test<Func>(nullptr))::value;
+};
+
+template < typename Func, typename ... Args >
+struct is_invocable_r_impl< void, Func, Args... > {
+private:
+    template < typename U >
+    static ::std::true_type
+    test(decltype(invoke_callable(::std::declval<U>(), ::std::declval<Args>()...))*);
+    template < typename U >
+    static ::std::false_type
+    test(...);
+public:
+    static constexpr bool value = decltype(test<Func>(nullptr))::value;
+};
+
+/**
+ * Object argument of a member function, with the cv and reference
+ * qualifiers of the function
+ */
+template < typename Traits >
+struct member_object_type {
+    using class_type    = typename Traits::class_type;
+    using cv_class_type = ::std::conditional_t< Traits::is_const,
+            ::std::conditional_t< Traits::is_volatile,
+                class_type const volatile, class_type const >,
+            ::std::conditional_t< Traits::is_volatile,
+                class_type volatile, class_type > >;
+    using type          = ::std::conditional_t<
+            Traits::ref == meta::ref_qualifier::rvalue,
+            cv_class_type&&, cv_class_type& >;
+};
+
+template < typename Object, typename Return, typename Args >
+struct member_signature;
+
+template < typename Object, typename Return, typename ... Args >
+struct member_signature< Object, Return, meta::type_tuple<Args...> > {
+    using type = Return(Object, Args...);
+};
+
+}  /* namespace detail */
+
+/**
+ * Metafunction to get a function type a callable can be stored as.
+ * Member function pointers take the object as the first argument,
+ * qualified like the member function.
+ */
+template < typename Func, bool = ::std::is_member_function_pointer<Func>::value >
+struct callable_signature : meta::function_signature< Func > {};
+
+template < typename Func >
+struct callable_signature< Func, true >
+    : detail::member_signature<
+        typename detail::member_object_type< meta::function_traits<Func> >::type,
+        typename meta::function_traits<Func>::result_type,
+        meta::function_args_t<Func> > {};
+
+template < typename Func >
+using callable_signature_t = typename callable_signature< ::std::decay_t<Func> >::type;
+
+template < typename Signature >
+class function_ref;
+
+/**
+ * Non-owning reference to a callable. Two pointers in size, never
+ * allocates. Function pointers are stored by value.
+ *
+ * The referenced callable object must outlive the function_ref, so don't
+ * store a function_ref bound to a temporary. This includes member function
+ * pointers, a member function pointer prvalue is rejected. A compile-time
+ * constant member function pointer is bound with make_function_ref<&C::f>()
+ * or an std::integral_constant and needs no storage.
+ *
+ * Usage:
+ * @code
+ * void
+ * for_each_row(function_ref<void(row const&)> cb);
+ *
+ * for_each_row([&](row const& r) { ... });
+ * @endcode
+ */
+template < typename Return, typename ... Args >
+class function_ref< Return(Args...) > {
+public:
+    using result_type = Return;
+
+    template < typename Func,
+        typename = ::std::enable_if_t<
+            !::std::is_same< ::std::decay_t<Func>, function_ref >::value &&
+            !::std::is_function< ::std::remove_pointer_t< ::std::decay_t<Func> > >::value &&
+            // A member function pointer must be an lvalue to be referred to
+            (!::std::is_member_pointer< ::std::decay_t<Func> >::value
+                || ::std::is_lvalue_reference<Func>::value) &&
+            detail::is_invocable_r_impl<Return, Func&, Args...>::value > >
+    function_ref(Func&& func) noexcept
+        : callee_{ const_cast<void*>(static_cast<void const*>(::std::addressof(func))) },
+          callback_{ &call_object< ::std::remove_reference_t<Func> > } {}
+
+    template < typename FuncReturn, typename ... FuncArgs,
+        typename = ::std::enable_if_t<
+            detail::is_invocable_r_impl<Return, FuncReturn(*)(FuncArgs...), Args...>::value > >
+    function_ref(FuncReturn(*func)(FuncArgs...)) noexcept
+        : callee_{ reinterpret_cast<void(*)()>(func) },
+          callback_{ &call_function< FuncReturn(*)(FuncArgs...) > } {}
+
+    template < typename Member, typename Class >
+    function_ref(Member Class::*&& func) = delete;
+
+    template < typename Member, typename Class, Member Class::* Func,
+        typename = ::std::enable_if_t<
+            detail::is_invocable_r_impl<Return, Member Class::*, Args...>::value > >
+    function_ref(::std::integral_constant< Member Class::*, Func > const&) noexcept
+        : callee_{ static_cast<void*>(nullptr) },
+          callback_{ &call_constant< Member Class::*, Func > } {}
+
+    function_ref(function_ref const&) noexcept = default;
+    function_ref&
+    operator = (function_ref const&) noexcept = default;
+
+    Return
+    operator()(Args ... args) const
+    {
+        return callback_(callee_, ::std::forward<Args>(args)...);
+    }
+private:
+    union callee {
+        void*   object;
+        void    (*function)();
+
+        callee(void* obj) noexcept : object{obj} {}
+        callee(void (*func)()) noexcept : function{func} {}
+    };
+    using callback_type = Return(*)(callee, Args&&...);
+
+    template < typename Func >
+    static Return
+    call_object(callee c, Args&& ... args)
+    {
+        return detail::invoke_callable(*static_cast<Func*>(c.object),
+                ::std::forward<Args>(args)...);
+    }
+
+    template < typename Func >
+    static Return
+    call_function(callee c, Args&& ... args)
+    {
+        return reinterpret_cast<Func>(c.function)(::std::forward<Args>(args)...);
+    }
+
+    template < typename Func, Func Member >
+    static Return
+    call_constant(callee, Args&& ... args)
+    {
+        return detail::invoke_callable(Member, ::std::forward<Args>(args)...);
+    }
+
+    callee          callee_;
+    callback_type   callback_;
+};
+
+/**
+ * Make a function_ref deducing the signature from a function pointer,
+ * a callable object with a non-template call operator or a member
+ * function pointer lvalue.
+ */
+template < typename Func >
+function_ref< callable_signature_t<Func> >
+make_function_ref(Func&& func) noexcept
+{
+    static_assert(!::std::is_member_pointer< ::std::decay_t<Func> >::value
+            || ::std::is_lvalue_reference<Func>::value,
+            "A function_ref cannot refer to a temporary member function pointer, "
+            "use make_function_ref<decltype(&C::f), &C::f>()");
+    return function_ref< callable_signature_t<Func> >{ ::std::forward<Func>(func) };
+}
+
+/**
+ * Make a function_ref to a compile-time constant member function pointer
+ * @code
+ * auto get = make_function_ref<decltype(&counter::get), &counter::get>();
+ * @endcode
+ */
+template < typename Func, Func Member >
+function_ref< callable_signature_t<Func> >
+make_function_ref() noexcept
+{
+    return function_ref< callable_signature_t<Func> >{
+        ::std::integral_constant<Func, Member>{} };
+}
+
+#if __cpp_nontype_template_parameter_auto >= 201606
+/**
+ * Make a function_ref to a compile-time constant member function pointer
+ * @code
+ * auto get = make_function_ref<&counter::get>();
+ * @endcode
+ */
+template < auto Member >
+function_ref< callable_signature_t<decltype(Member)> >
+make_function_ref() noexcept
+{
+    return make_function_ref<decltype(Member), Member>();
+}
+#endif
+
+#if __cpp_deduction_guides >= 201606
+template < typename Return, typename ... Args >
+function_ref(Return(*)(Args...)) -> function_ref< Return(Args...) >;
+
+template < typename Func >
+function_ref(Func&&) -> function_ref< callable_signature_t<Func> >;
+#endif
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_FUNCTION_REF_HPP_ */
@@ -0,0 +1,459 @@
+/*
+ * fuse.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_FUSE_HPP_
+#define PUSHKIN_UTIL_FUSE_HPP_
+
+#include <pushkin/meta/callable.hpp>
+#include <pushkin/meta/function_traits.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+namespace psst {
+namespace util {
+
+/**
+ * Transform a value with a unary function
+ */
+template < typename Func >
+struct map_ {
+    using function_type = Func;
+};
+
+/**
+ * Drop values that don't match a predicate. The predicate is a unary
+ * function returning a value convertible to bool or a predicate
+ * combinator.
+ */
+template < typename Predicate >
+struct filter_ {
+    using predicate_type = Predicate;
+};
+
+/**
+ * Accumulate values with a binary function `Acc(Acc, T)`, must be the
+ * last operation. Partial results of parallel execution are combined
+ * with a binary function `Acc(Acc, Acc)`.
+ */
+template < typename Func, typename Combine = Func >
+struct reduce_ {
+    using function_type = Func;
+    using combine_type  = Combine;
+};
+
+/**
+ * Minimal number of values processed by a thread in parallel execution
+ */
+constexpr ::std::size_t fuse_min_chunk = 4096;
+
+namespace detail {
+
+template < typename Func >
+struct fuse_unary_traits {
+    using traits        = meta::function_traits<Func>;
+    static_assert(traits::arity == 1, "Map and filter functions must take a single argument");
+
+    using argument_type = typename traits::args_tuple_type;
+    using result_type   = typename traits::result_type;
+};
+
+template < typename Func >
+struct fuse_binary_traits {
+    using traits        = meta::function_traits<Func>;
+    static_assert(traits::arity == 2, "Reduce functions must take two arguments");
+
+    using accumulator_type  = typename ::std::decay<
+            typename traits::template arg<0>::type >::type;
+    using argument_type     = typename traits::template arg<1>::type;
+    using result_type       = typename traits::result_type;
+    static_assert(::std::is_convertible<result_type, accumulator_type>::value,
+            "Result of a reduce function must be convertible to the accumulator");
+};
+
+/**
+ * Predicate combinators have template call operators, they are checked
+ * by a call with the value
+ */
+template < typename T, typename Predicate,
+        bool = ::std::is_base_of<meta::detail::predicate_combinator, Predicate>::value >
+struct check_fuse_predicate {
+    static_assert(::std::is_convertible<T,
+            typename fuse_unary_traits<Predicate>::argument_type>::value,
+            "Filter predicate cannot be called with the result of the previous operation");
+    static_assert(::std::is_convertible<
+            typename fuse_unary_traits<Predicate>::result_type, bool>::value,
+            "Filter predicate must return a value convertible to bool");
+    static constexpr bool value = true;
+};
+
+template < typename T, typename Predicate >
+struct check_fuse_predicate< T, Predicate, true > {
+    static_assert(meta::is_callable<Predicate, T const&>::value,
+            "Filter predicate cannot be called with the result of the previous operation");
+    static constexpr bool value = true;
+};
+
+/**
+ * Chain of operations applied to a value of type T. Operations after a
+ * filter are not evaluated for the values it rejects.
+ *
+ * apply writes the result to the output slot and returns true if the
+ * value is kept, accumulate adds the result to the accumulator.
+ */
+template < typename T, typename ... Op >
+struct fuse_chain {
+    using value_type        = T;
+    using accumulator_type  = void;
+    using tail              = fuse_chain;
+
+    template < typename Out >
+    static bool
+    apply(T const& value, Out& out)
+    {
+        out = value;
+        return true;
+    }
+};
+
+template < typename T, typename Func, typename ... Rest >
+struct fuse_chain< T, map_<Func>, Rest... > {
+    using traits            = fuse_unary_traits<Func>;
+    static_assert(::std::is_convertible<T, typename traits::argument_type>::value,
+            "Map function cannot be called with the result of the previous operation");
+    using mapped_type       = typename ::std::decay< typename traits::result_type >::type;
+    static_assert(!::std::is_void<mapped_type>::value, "Map function must return a value");
+
+    using next              = fuse_chain< mapped_type, Rest... >;
+    using value_type        = typename next::value_type;
+    using accumulator_type  = typename next::accumulator_type;
+    using tail              = typename next::tail;
+
+    template < typename Out >
+    static bool
+    apply(T const& value, Out& out)
+    { return next::apply(Func{}(value), out); }
+    template < typename Acc >
+    static void
+    accumulate(Acc& acc, T const& value)
+    { next::accumulate(acc, Func{}(value)); }
+};
+
+template < typename T, typename Predicate, typename ... Rest >
+struct fuse_chain< T, filter_<Predicate>, Rest... > {
+    static_assert(check_fuse_predicate<T, Predicate>::value, "");
+
+    using next              = fuse_chain< T, Rest... >;
+    using value_type        = typename next::value_type;
+    using accumulator_type  = typename next::accumulator_type;
+    using tail              = typename next::tail;
+
+    template < typename Out >
+    static bool
+    apply(T const& value, Out& out)
+    {
+        return meta::detail::fused_call<Predicate>::apply(value)
+                && next::apply(value, out);
+    }
+    template < typename Acc >
+    static void
+    accumulate(Acc& acc, T const& value)
+    {
+        if (meta::detail::fused_call<Predicate>::apply(value))
+            next::accumulate(acc, value);
+    }
+};
+
+/**
+ * A filter that is the last operation doesn't guard anything, the value
+ * is written unconditionally and the predicate result is returned
+ */
+template < typename T, typename Predicate >
+struct fuse_chain< T, filter_<Predicate> > {
+    static_assert(check_fuse_predicate<T, Predicate>::value, "");
+
+    using value_type        = T;
+    using accumulator_type  = void;
+    using tail              = fuse_chain;
+
+    template < typename Out >
+    static bool
+    apply(T const& value, Out& out)
+    {
+        out = value;
+        return meta::detail::fused_call<Predicate>::apply(value);
+    }
+};
+
+template < typename T, typename Func, typename Combine, typename ... Rest >
+struct fuse_chain< T, reduce_<Func, Combine>, Rest... > {
+    static_assert(sizeof ... (Rest) == 0, "Reduce must be the last operation");
+
+    using traits            = fuse_binary_traits<Func>;
+    static_assert(::std::is_convertible<T, typename traits::argument_type>::value,
+            "Reduce function cannot be called with the result of the previous operation");
+
+    using value_type        = T;
+    using accumulator_type  = typename traits::accumulator_type;
+    using tail              = fuse_chain;
+
+    static void
+    accumulate(accumulator_type& acc, value_type const& value)
+    {
+        acc = Func{}(acc, value);
+    }
+
+    static accumulator_type
+    combine(accumulator_type const& lhs, accumulator_type const& rhs)
+    {
+        using combine_traits = fuse_binary_traits<Combine>;
+        static_assert(::std::is_convertible<accumulator_type,
+                typename combine_traits::argument_type>::value
+            && ::std::is_convertible<typename combine_traits::accumulator_type,
+                accumulator_type>::value,
+                "Combine function must take two accumulators");
+        return Combine{}(lhs, rhs);
+    }
+};
+
+template < typename T, typename ... Op >
+struct fuse_kernel {
+    using chain             = fuse_chain<T, Op...>;
+    using value_type        = typename chain::value_type;
+    using accumulator_type  = typename chain::accumulator_type;
+    static constexpr bool has_reduce = !::std::is_void<accumulator_type>::value;
+
+    /**
+     * Values are written to the output at the position after the last
+     * kept value, the position advances only if the value is kept
+     */
+    template < typename Out >
+    static ::std::size_t
+    compact(T const* data, ::std::size_t n, Out* out)
+    {
+        ::std::size_t count = 0;
+        for (::std::size_t i = 0; i < n; ++i)
+            count += chain::apply(data[i], out[count]);
+        return count;
+    }
+
+    template < typename Acc >
+    static Acc
+    reduce(T const* data, ::std::size_t n, Acc acc)
+    {
+        for (::std::size_t i = 0; i < n; ++i)
+            chain::accumulate(acc, data[i]);
+        return acc;
+    }
+};
+
+template < typename T, typename ... Op >
+using fuse_compact_t = typename ::std::enable_if<
+        !fuse_kernel<T, Op...>::has_reduce, ::std::size_t >::type;
+template < typename T, typename ... Op >
+using fuse_reduce_t = typename ::std::enable_if<
+        fuse_kernel<T, Op...>::has_reduce,
+        typename fuse_kernel<T, Op...>::accumulator_type >::type;
+
+inline ::std::size_t
+fuse_chunk_count(::std::size_t n, unsigned threads) noexcept
+{
+    ::std::size_t chunks = n / fuse_min_chunk;
+    if (chunks > threads)
+        chunks = threads;
+    return chunks > 0 ? chunks : 1;
+}
+
+/**
+ * Run a function for each chunk of the data, the first chunk is
+ * processed by the calling thread. All threads are joined before an
+ * exception is rethrown, the exception of the first failed chunk wins.
+ */
+template < typename Func >
+void
+fuse_for_each_chunk(::std::size_t n, ::std::size_t chunks, Func&& func)
+{
+    ::std::size_t const chunk = (n + chunks - 1) / chunks;
+    ::std::vector<::std::exception_ptr> errors(chunks);
+    ::std::vector<::std::thread> workers;
+    workers.reserve(chunks - 1);
+    auto run = [&func, &errors](::std::size_t k, ::std::size_t begin, ::std::size_t size)
+    {
+        try {
+            func(k, begin, size);
+        } catch (...) {
+            errors[k] = ::std::current_exception();
+        }
+    };
+    try {
+        for (::std::size_t k = 1; k < chunks; ++k) {
+            ::std::size_t const begin = k * chunk;
+            workers.emplace_back(run, k, begin, ::std::min(chunk, n - begin));
+        }
+    } catch (...) {
+        for (auto& w : workers)
+            w.join();
+        throw;
+    }
+    run(0, 0, ::std::min(chunk, n));
+    for (auto& w : workers)
+        w.join();
+    for (auto const& e : errors) {
+        if (e)
+            ::std::rethrow_exception(e);
+    }
+}
+
+}  /* namespace detail */
+
+//@{
+/**
+ * Apply a chain of map and filter operations to the data in a single
+ * loop and write the values that pass all filters to the output, in
+ * order. The output must have room for n values.
+ *
+ * Operations after a filter are evaluated only for the values it keeps,
+ * this is a branch on the result of the filter. When the filter is the
+ * last operation the compaction is branchless: the value is written to
+ * the output slot unconditionally and the output position advances only
+ * if the value is kept.
+ *
+ * Operations are default-constructible function objects, signatures are
+ * checked at compile time.
+ *
+ * Usage:
+ * @code
+ * auto count = fuse< map_<scale>, filter_<in_range>, map_<to_fixed> >(
+ *         prices.data(), prices.size(), out.data());
+ * @endcode
+ *
+ * @return Number of values written to the output
+ */
+template < typename ... Op, typename T, typename Out >
+detail::fuse_compact_t<T, Op...>
+fuse(T const* data, ::std::size_t n, Out* out)
+{
+    return detail::fuse_kernel<T, Op...>::compact(data, n, out);
+}
+
+/**
+ * Apply a chain of map and filter operations ending with a reduce in a
+ * single loop.
+ *
+ * Usage:
+ * @code
+ * auto total = fuse< filter_<is_buy>, map_<notional>, reduce_<plus> >(
+ *         orders.data(), orders.size(), 0.0);
+ * @endcode
+ *
+ * @return Accumulated value
+ */
+template < typename ... Op, typename T, typename Acc >
+detail::fuse_reduce_t<T, Op...>
+fuse(T const* data, ::std::size_t n, Acc const& init)
+{
+    using accumulator_type = typename detail::fuse_kernel<T, Op...>::accumulator_type;
+    return detail::fuse_kernel<T, Op...>::reduce(data, n, accumulator_type(init));
+}
+
+#if __cplusplus >= 202002L
+template < typename ... Op, ::std::ranges::contiguous_range Range, typename Out >
+    requires ::std::ranges::sized_range<Range>
+detail::fuse_compact_t< ::std::ranges::range_value_t<Range>, Op... >
+fuse(Range&& data, Out* out)
+{
+    return fuse<Op...>(::std::ranges::data(data), ::std::ranges::size(data), out);
+}
+
+template < typename ... Op, ::std::ranges::contiguous_range Range, typename Acc >
+    requires ::std::ranges::sized_range<Range>
+detail::fuse_reduce_t< ::std::ranges::range_value_t<Range>, Op... >
+fuse(Range&& data, Acc const& init)
+{
+    return fuse<Op...>(::std::ranges::data(data), ::std::ranges::size(data), init);
+}
+#endif
+//@}
+
+//@{
+/**
+ * Parallel version of fuse. The data is split into contiguous chunks of
+ * at least fuse_min_chunk values, one per thread. Each chunk is
+ * compacted in place of the output, then the chunks are moved together.
+ * The order of values is preserved.
+ *
+ * @return Number of values written to the output
+ */
+template < typename ... Op, typename T, typename Out >
+detail::fuse_compact_t<T, Op...>
+fuse_parallel(T const* data, ::std::size_t n, Out* out,
+        unsigned threads = ::std::thread::hardware_concurrency())
+{
+    using kernel = detail::fuse_kernel<T, Op...>;
+    auto const chunks = detail::fuse_chunk_count(n, threads);
+    if (chunks == 1)
+        return kernel::compact(data, n, out);
+
+    ::std::vector<::std::size_t> counts(chunks);
+    detail::fuse_for_each_chunk(n, chunks,
+        [&counts, data, out](::std::size_t k, ::std::size_t begin, ::std::size_t size) {
+            counts[k] = kernel::compact(data + begin, size, out + begin);
+        });
+    ::std::size_t const chunk = (n + chunks - 1) / chunks;
+    ::std::size_t count = counts[0];
+    for (::std::size_t k = 1; k < chunks; ++k) {
+        auto begin = out + k * chunk;
+        ::std::move(begin, begin + counts[k], out + count);
+        count += counts[k];
+    }
+    return count;
+}
+
+/**
+ * Parallel version of fuse with a reduce. Each chunk is accumulated
+ * starting with init, so init must be the identity of the reduction,
+ * partial results are combined in the order of chunks.
+ *
+ * @return Accumulated value
+ */
+template < typename ... Op, typename T, typename Acc >
+detail::fuse_reduce_t<T, Op...>
+fuse_parallel(T const* data, ::std::size_t n, Acc const& init,
+        unsigned threads = ::std::thread::hardware_concurrency())
+{
+    using kernel = detail::fuse_kernel<T, Op...>;
+    using accumulator_type = typename kernel::accumulator_type;
+    auto const chunks = detail::fuse_chunk_count(n, threads);
+    if (chunks == 1)
+        return kernel::reduce(data, n, accumulator_type(init));
+
+    ::std::vector<accumulator_type> partial(chunks, accumulator_type(init));
+    detail::fuse_for_each_chunk(n, chunks,
+        [&partial, data](::std::size_t k, ::std::size_t begin, ::std::size_t size) {
+            partial[k] = kernel::reduce(data + begin, size, partial[k]);
+        });
+    accumulator_type res = partial[0];
+    for (::std::size_t k = 1; k < chunks; ++k)
+        res = kernel::chain::tail::combine(res, partial[k]);
+    return res;
+}
+//@}
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_FUSE_HPP_ */
@@ -0,0 +1,61 @@
+/*
+ * hex.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_HEX_HPP_
+#define PUSHKIN_UTIL_HEX_HPP_
+
+#include <pushkin/meta/table.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace psst {
+namespace util {
+
+/**
+ * Generator of a byte to lowercase hex digit pair table
+ */
+struct hex_pair_generator {
+    constexpr char
+    operator()(::std::size_t byte, ::std::size_t digit) const noexcept
+    {
+        return "0123456789abcdef"[digit == 0 ? byte >> 4 : byte & 0xf];
+    }
+};
+
+using hex_pairs_type = ::std::array< ::std::array<char, 2>, 256 >;
+
+/**
+ * Byte to hex digit pair table, generated at compile time
+ */
+inline hex_pairs_type const&
+hex_pairs() noexcept
+{
+    static constexpr hex_pairs_type pairs = meta::make_table<256, 2, hex_pair_generator>();
+    return pairs;
+}
+
+/**
+ * Write bytes as lowercase hex digits, two characters per byte
+ * @return End of the output
+ */
+inline char*
+to_hex(void const* data, ::std::size_t size, char* out) noexcept
+{
+    auto const& pairs = hex_pairs();
+    auto p = static_cast<unsigned char const*>(data);
+    for (::std::size_t i = 0; i < size; ++i) {
+        *out++ = pairs[p[i]][0];
+        *out++ = pairs[p[i]][1];
+    }
+    return out;
+}
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_HEX_HPP_ */
@@ -0,0 +1,213 @@
+/*
+ * inplace_function.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_INPLACE_FUNCTION_HPP_
+#define PUSHKIN_UTIL_INPLACE_FUNCTION_HPP_
+
+#include <pushkin/util/function_ref.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <new>
+
+namespace psst {
+namespace util {
+
+constexpr ::std::size_t inplace_function_default_capacity = 4 * sizeof(void*);
+
+template < typename Signature,
+        ::std::size_t Capacity = inplace_function_default_capacity,
+        ::std::size_t Alignment = alignof(::std::max_align_t) >
+class inplace_function;
+
+/**
+ * Owning callable wrapper with a fixed size buffer. Never allocates,
+ * a callable that doesn't fit into the buffer is a compile error.
+ *
+ * Like std::function, requires the callable to be copy constructible
+ * and throws std::bad_function_call when an empty function is called.
+ * The callable must also be nothrow move constructible, so that moving
+ * an inplace_function never throws.
+ */
+template < typename Return, typename ... Args,
+        ::std::size_t Capacity, ::std::size_t Alignment >
+class inplace_function< Return(Args...), Capacity, Alignment > {
+public:
+    using result_type = Return;
+    static constexpr ::std::size_t capacity = Capacity;
+    static constexpr ::std::size_t alignment = Alignment;
+public:
+    inplace_function() noexcept
+        : vtable_{nullptr}, storage_{} {}
+    inplace_function(::std::nullptr_t) noexcept
+        : vtable_{nullptr}, storage_{} {}
+
+    template < typename Func,
+        typename = ::std::enable_if_t<
+            !::std::is_same< ::std::decay_t<Func>, inplace_function >::value &&
+            detail::is_invocable_r_impl<Return, ::std::decay_t<Func>&, Args...>::value > >
+    inplace_function(Func&& func)
+        : vtable_{ vtable_for< ::std::decay_t<Func> >() }, storage_{}
+    {
+        using callable_type = ::std::decay_t<Func>;
+        static_assert(sizeof(callable_type) <= Capacity,
+                "The callable doesn't fit into the inplace_function buffer");
+        static_assert(Alignment % alignof(callable_type) == 0,
+                "The callable's alignment is incompatible with the inplace_function buffer");
+        static_assert(::std::is_copy_constructible<callable_type>::value,
+                "The callable must be copy constructible");
+        static_assert(::std::is_nothrow_move_constructible<callable_type>::value,
+                "The callable must be nothrow move constructible");
+        ::new (&storage_) callable_type( ::std::forward<Func>(func) );
+    }
+
+    inplace_function(inplace_function const& rhs)
+        : vtable_{rhs.vtable_}, storage_{}
+    {
+        if (vtable_)
+            vtable_->copy(&storage_, &rhs.storage_);
+    }
+    inplace_function(inplace_function&& rhs) noexcept
+        : vtable_{rhs.vtable_}, storage_{}
+    {
+        if (vtable_)
+            vtable_->move(&storage_, &rhs.storage_);
+    }
+    ~inplace_function()
+    {
+        reset();
+    }
+
+    inplace_function&
+    operator = (inplace_function const& rhs)
+    {
+        if (this != &rhs) {
+            reset();
+            if (rhs.vtable_)
+                rhs.vtable_->copy(&storage_, &rhs.storage_);
+            vtable_ = rhs.vtable_;
+        }
+        return *this;
+    }
+    inplace_function&
+    operator = (inplace_function&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            reset();
+            if (rhs.vtable_)
+                rhs.vtable_->move(&storage_, &rhs.storage_);
+            vtable_ = rhs.vtable_;
+        }
+        return *this;
+    }
+    inplace_function&
+    operator = (::std::nullptr_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+    Return
+    operator()(Args ... args) const
+    {
+        if (!vtable_)
+            throw ::std::bad_function_call{};
+        return vtable_->invoke(&storage_, ::std::forward<Args>(args)...);
+    }
+
+    explicit
+    operator bool() const noexcept
+    { return vtable_ != nullptr; }
+private:
+    struct vtable {
+        Return  (*invoke)(void*, Args&&...);
+        void    (*copy)(void*, void const*);
+        void    (*move)(void*, void*) noexcept;
+        void    (*destroy)(void*);
+    };
+
+    template < typename Func >
+    static Return
+    invoke_impl(void* func, Args&& ... args)
+    {
+        return detail::invoke_callable(*static_cast<Func*>(func),
+                ::std::forward<Args>(args)...);
+    }
+    template < typename Func >
+    static void
+    copy_impl(void* dst, void const* src)
+    {
+        ::new (dst) Func( *static_cast<Func const*>(src) );
+    }
+    template < typename Func >
+    static void
+    move_impl(void* dst, void* src) noexcept
+    {
+        ::new (dst) Func( ::std::move(*static_cast<Func*>(src)) );
+    }
+    template < typename Func >
+    static void
+    destroy_impl(void* func)
+    {
+        static_cast<Func*>(func)->~Func();
+    }
+
+    template < typename Func >
+    static vtable const*
+    vtable_for() noexcept
+    {
+        static constexpr vtable table{
+            &invoke_impl<Func>, &copy_impl<Func>, &move_impl<Func>, &destroy_impl<Func>
+        };
+        return &table;
+    }
+
+    void
+    reset() noexcept
+    {
+        if (vtable_) {
+            vtable_->destroy(&storage_);
+            vtable_ = nullptr;
+        }
+    }
+
+    union storage_type {
+        storage_type() noexcept : none{} {}
+
+        char                                none;
+        alignas(Alignment) unsigned char    data[Capacity];
+    };
+
+    vtable const*           vtable_;
+    mutable storage_type    storage_;
+};
+
+/**
+ * Make an inplace_function deducing the signature from a function pointer,
+ * a callable object with a non-template call operator or a member
+ * function pointer.
+ */
+template < ::std::size_t Capacity = inplace_function_default_capacity, typename Func >
+inplace_function< callable_signature_t<Func>, Capacity >
+make_inplace_function(Func&& func)
+{
+    return inplace_function< callable_signature_t<Func>, Capacity >{
+        ::std::forward<Func>(func) };
+}
+
+#if __cpp_deduction_guides >= 201606
+template < typename Return, typename ... Args >
+inplace_function(Return(*)(Args...)) -> inplace_function< Return(Args...) >;
+
+template < typename Func >
+inplace_function(Func) -> inplace_function< callable_signature_t<Func> >;
+#endif
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_INPLACE_FUNCTION_HPP_ */
@@ -0,0 +1,498 @@
+/*
+ * pipeline.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_PIPELINE_HPP_
+#define PUSHKIN_UTIL_PIPELINE_HPP_
+
+#include <pushkin/meta/function_traits.hpp>
+#include <pushkin/meta/type_tuple.hpp>
+#include <pushkin/util/ring_buffer.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace psst {
+namespace util {
+
+/**
+ * Number of times an idle stage yields before it blocks waiting for input
+ */
+constexpr ::std::size_t pipeline_idle_spins = 64;
+/**
+ * Longest time a blocked stage sleeps without rechecking it's input
+ */
+constexpr ::std::chrono::milliseconds pipeline_idle_timeout{100};
+
+/**
+ * Counters of a pipeline stage
+ */
+struct pipeline_stage_stats {
+    /**
+     * Number of values processed by the stage
+     */
+    ::std::size_t   processed;
+    /**
+     * Number of non-empty batches taken from the input queue
+     */
+    ::std::size_t   batches;
+    /**
+     * Number of times the stage waited for space in the next queue
+     */
+    ::std::size_t   stalls;
+    /**
+     * Approximate number of values in the input queue of the stage
+     */
+    ::std::size_t   queue_depth;
+};
+
+namespace detail {
+
+/**
+ * Argument and result type of a pipeline stage, a stage is a callable
+ * with a single argument
+ */
+template < typename Stage >
+struct pipeline_stage_traits {
+    using traits        = meta::function_traits<Stage>;
+    static_assert(traits::arity == 1, "A pipeline stage must take a single argument");
+
+    using argument_type = typename ::std::decay< typename traits::args_tuple_type >::type;
+    using result_type   = typename traits::result_type;
+};
+
+template < ::std::size_t Index, typename Result, typename Argument >
+struct check_stage_connection {
+    static_assert(!::std::is_void<Result>::value,
+            "Only the last stage of a pipeline can return void");
+    static_assert(::std::is_convertible<Result, Argument>::value,
+            "Result of a pipeline stage is not convertible to the argument of the next stage");
+    static constexpr bool value = true;
+};
+
+/**
+ * Check that the result of each stage converts to the argument of the
+ * next one, the index of a failing stage is in the instantiation context
+ * of the static_assert
+ */
+template < ::std::size_t Index, typename ... Stage >
+struct check_stage_connections : ::std::true_type {};
+
+template < ::std::size_t Index, typename Stage, typename Next, typename ... Rest >
+struct check_stage_connections< Index, Stage, Next, Rest... >
+    : ::std::integral_constant< bool,
+        check_stage_connection< Index,
+            typename pipeline_stage_traits<Stage>::result_type,
+            typename pipeline_stage_traits<Next>::argument_type >::value
+        && check_stage_connections< Index + 1, Next, Rest... >::value > {};
+
+/**
+ * Output of a pipeline whose last stage returns void
+ */
+struct pipeline_no_output {};
+
+template < typename T, ::std::size_t Capacity >
+struct pipeline_output_queue {
+    using type = spsc_ring_buffer<T, Capacity>;
+};
+
+template < ::std::size_t Capacity >
+struct pipeline_output_queue< void, Capacity > {
+    using type = pipeline_no_output;
+};
+
+/**
+ * Counters are written only by the stage thread and read by others,
+ * each stage has it's own cache line. The stage blocks on the condition
+ * variable when it has been idle for a while, the producer of the input
+ * takes the mutex only if the stage is sleeping.
+ */
+struct alignas(cache_line_size) pipeline_stage_counters {
+    pipeline_stage_counters()
+        : processed{0}, batches{0}, stalls{0}, input_done{false},
+          sleeping{false}, mutex{}, wakeup{} {}
+
+    ::std::atomic<::std::size_t>    processed;
+    ::std::atomic<::std::size_t>    batches;
+    ::std::atomic<::std::size_t>    stalls;
+    ::std::atomic<bool>             input_done;
+    ::std::atomic<bool>             sleeping;
+    ::std::mutex                    mutex;
+    ::std::condition_variable       wakeup;
+
+    /**
+     * Wake the stage up if it waits for input. Called after a value is
+     * pushed to the input queue or the input is closed.
+     */
+    void
+    notify()
+    {
+        // Pairs with the fence in wait, either the stage sees the input
+        // or this thread sees the stage sleeping
+        ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+        if (sleeping.load(::std::memory_order_relaxed)) {
+            ::std::lock_guard<::std::mutex> lock{mutex};
+            wakeup.notify_one();
+        }
+    }
+    /**
+     * Block until the predicate returns true, the predicate checks the
+     * input queue and the input_done flag. The wait is timed, so the
+     * stage rechecks the input now and then even without a notification.
+     */
+    template < typename Predicate >
+    void
+    wait(Predicate&& ready)
+    {
+        ::std::unique_lock<::std::mutex> lock{mutex};
+        sleeping.store(true, ::std::memory_order_relaxed);
+        ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+        while (!wakeup.wait_for(lock, pipeline_idle_timeout, ready));
+        sleeping.store(false, ::std::memory_order_relaxed);
+    }
+
+    /**
+     * Increment a counter that has a single writer, without a locked
+     * read-modify-write instruction
+     */
+    static void
+    add(::std::atomic<::std::size_t>& counter, ::std::size_t n) noexcept
+    {
+        counter.store(counter.load(::std::memory_order_relaxed) + n,
+                ::std::memory_order_relaxed);
+    }
+};
+
+}  /* namespace detail */
+
+template < typename Stages, ::std::size_t Capacity = 1024, ::std::size_t Batch = 64 >
+class pipeline;
+
+/**
+ * Chain of stages, each stage runs in it's own thread. Stages are
+ * connected by bounded lock-free single producer single consumer queues
+ * of Capacity values, a stage takes up to Batch values from it's input
+ * queue at once and processes them in place. A stage waits while the
+ * next queue is full, so a slow stage throttles the stages before it
+ * down to the producer.
+ *
+ * Each stage is a callable with a single argument. The result of a stage
+ * must be convertible to the argument of the next stage, this is checked
+ * at compile time. The last stage may return void, otherwise it's results
+ * are read with try_pop.
+ *
+ * A stage that has no input yields for a while and then blocks until a
+ * value is pushed to it, so an idle pipeline doesn't keep the cores busy.
+ *
+ * Values are pushed from a single thread. Exceptions escaping a stage
+ * terminate the program. The destructor processes the values that are
+ * already pushed, but drops the results that don't fit into the output
+ * queue, so a pipeline whose results are not consumed can be destroyed.
+ *
+ * Usage:
+ * @code
+ * using etl = pipeline< type_tuple<parse, validate, store> >;
+ * etl p;
+ * for (auto const& line : lines)
+ *     p.push(line);
+ * p.close();
+ * auto parsed = p.stats<0>().processed;
+ * @endcode
+ */
+template < typename ... Stage, ::std::size_t Capacity, ::std::size_t Batch >
+class pipeline< meta::type_tuple<Stage...>, Capacity, Batch > {
+    static_assert(sizeof ... (Stage) > 0, "Pipeline must have at least one stage");
+    static_assert(Batch > 0, "Batch size must be positive");
+    static_assert(detail::check_stage_connections<0, Stage...>::value, "");
+public:
+    using stages_type   = meta::type_tuple<Stage...>;
+    static constexpr ::std::size_t stage_count  = sizeof ... (Stage);
+    static constexpr ::std::size_t capacity     = Capacity;
+    static constexpr ::std::size_t batch_size   = Batch;
+    static constexpr ::std::size_t npos = ::std::numeric_limits<::std::size_t>::max();
+
+    template < ::std::size_t I >
+    using stage_type        = typename stages_type::template type<I>;
+    template < ::std::size_t I >
+    using argument_type     = typename detail::pipeline_stage_traits<
+            stage_type<I> >::argument_type;
+    template < ::std::size_t I >
+    using result_type       = typename detail::pipeline_stage_traits<
+            stage_type<I> >::result_type;
+
+    using input_type        = argument_type<0>;
+    using output_type       = result_type<stage_count - 1>;
+public:
+    pipeline() : pipeline(Stage{}...) {}
+    explicit
+    pipeline(Stage const& ... stages)
+        : stages_{ stages... }, queues_{}, output_{}, counters_{},
+          threads_{}, closed_{false}, discard_output_{false}
+    {
+        try {
+            start(::std::index_sequence_for<Stage...>{});
+        } catch (...) {
+            // Stop the threads that are already started
+            close();
+            throw;
+        }
+    }
+    pipeline(pipeline const&) = delete;
+    pipeline&
+    operator = (pipeline const&) = delete;
+    ~pipeline()
+    {
+        discard_output_.store(true, ::std::memory_order_release);
+        close();
+    }
+
+    /**
+     * Push a value to the first stage.
+     * @return false if the input queue is full
+     */
+    template < typename T >
+    bool
+    try_push(T&& value)
+    {
+        if (!::std::get<0>(queues_).try_push(::std::forward<T>(value)))
+            return false;
+        counters_[0].notify();
+        return true;
+    }
+    /**
+     * Push a value to the first stage, yield while the input queue is full
+     */
+    template < typename T >
+    void
+    push(T&& value)
+    {
+        auto& q = ::std::get<0>(queues_);
+        // Convert once, the converted value is not consumed unless it's
+        // pushed
+        argument_type<0> arg(::std::forward<T>(value));
+        while (!q.try_push(::std::move(arg)))
+            ::std::this_thread::yield();
+        counters_[0].notify();
+    }
+
+    /**
+     * Pop a result of the last stage. The results must be consumed while
+     * the pipeline runs, otherwise the last stage stops when the output
+     * queue is full.
+     * @return false if there are no results
+     */
+    template < typename T = output_type >
+    bool
+    try_pop(T& value)
+    {
+        return output_.try_pop(value);
+    }
+    /**
+     * Call a function for up to max results of the last stage
+     * @return Number of results consumed
+     */
+    template < typename Func >
+    ::std::size_t
+    consume(Func&& func, ::std::size_t max = npos)
+    {
+        static_assert(!::std::is_void<output_type>::value,
+                "The last stage of the pipeline doesn't produce results");
+        return output_.consume(::std::forward<Func>(func), max);
+    }
+
+    /**
+     * Signal the end of input, wait for the stages to process all values
+     * and stop the threads. Values cannot be pushed after close.
+     *
+     * If the last stage produces results, they must be consumed by another
+     * thread while close waits, or fit into the output queue. Otherwise
+     * the last stage waits for space in the output queue and close never
+     * returns. The destructor drops the results that don't fit instead.
+     */
+    void
+    close()
+    {
+        if (closed_)
+            return;
+        closed_ = true;
+        counters_[0].input_done.store(true, ::std::memory_order_release);
+        counters_[0].notify();
+        for (auto& t : threads_) {
+            if (t.joinable())
+                t.join();
+        }
+    }
+
+    template < ::std::size_t I >
+    pipeline_stage_stats
+    stats() const noexcept
+    {
+        static_assert(I < stage_count, "Stage index is out of range");
+        auto const& c = counters_[I];
+        return pipeline_stage_stats{
+            c.processed.load(::std::memory_order_relaxed),
+            c.batches.load(::std::memory_order_relaxed),
+            c.stalls.load(::std::memory_order_relaxed),
+            ::std::get<I>(queues_).size() };
+    }
+    /**
+     * Counters of all stages
+     */
+    ::std::array< pipeline_stage_stats, stage_count >
+    stats() const noexcept
+    {
+        return all_stats(::std::index_sequence_for<Stage...>{});
+    }
+private:
+    template < ::std::size_t I >
+    using queue_type        = spsc_ring_buffer< argument_type<I>, Capacity >;
+    using output_queue_type = typename detail::pipeline_output_queue<
+            output_type, Capacity >::type;
+    template < ::std::size_t I >
+    using has_next          = ::std::integral_constant< bool, (I + 1 < stage_count) >;
+    template < ::std::size_t ... I >
+    using queues_type       = ::std::tuple< queue_type<I>... >;
+
+    template < ::std::size_t ... I >
+    static queues_type<I...>
+    make_queues_type(::std::index_sequence<I...> const&);
+
+    template < ::std::size_t ... I >
+    void
+    start(::std::index_sequence<I...> const&)
+    {
+        (void)::std::initializer_list<int>{
+            (threads_[I] = ::std::thread{ &pipeline::run_stage<I>, this }, 0)... };
+    }
+
+    template < ::std::size_t ... I >
+    ::std::array< pipeline_stage_stats, stage_count >
+    all_stats(::std::index_sequence<I...> const&) const noexcept
+    {
+        return {{ stats<I>()... }};
+    }
+
+    template < ::std::size_t I >
+    void
+    run_stage()
+    {
+        auto& in = ::std::get<I>(queues_);
+        auto& counters = counters_[I];
+        auto handle = [this](argument_type<I>& value) {
+            this->template process<I>(value, ::std::is_void< result_type<I> >{});
+        };
+        auto ready = [&in, &counters]() {
+            return !in.empty() || counters.input_done.load(::std::memory_order_acquire);
+        };
+        ::std::size_t idle = 0;
+        while (true) {
+            auto n = in.consume(handle, Batch);
+            if (n > 0) {
+                idle = 0;
+                detail::pipeline_stage_counters::add(counters.processed, n);
+                detail::pipeline_stage_counters::add(counters.batches, 1);
+            } else if (counters.input_done.load(::std::memory_order_acquire)) {
+                // All values are in the queue before the flag is set
+                if (in.empty())
+                    break;
+            } else if (++idle < pipeline_idle_spins) {
+                ::std::this_thread::yield();
+            } else {
+                counters.wait(ready);
+                idle = 0;
+            }
+        }
+        finish(::std::integral_constant< ::std::size_t, I >{}, has_next<I>{});
+    }
+
+    template < ::std::size_t I >
+    void
+    process(argument_type<I>& value, ::std::false_type const&)
+    {
+        emit<I>(meta::invoke(::std::get<I>(stages_), ::std::move(value)));
+    }
+    template < ::std::size_t I >
+    void
+    process(argument_type<I>& value, ::std::true_type const&)
+    {
+        meta::invoke(::std::get<I>(stages_), ::std::move(value));
+    }
+
+    template < ::std::size_t I, typename T >
+    void
+    emit(T&& result)
+    {
+        auto& q = next_queue<I>(has_next<I>{});
+        using value_type = typename ::std::decay<decltype(q)>::type::value_type;
+        value_type value(::std::forward<T>(result));
+        if (!q.try_push(::std::move(value))) {
+            detail::pipeline_stage_counters::add(counters_[I].stalls, 1);
+            while (!q.try_push(::std::move(value))) {
+                // Nobody will read the output of a pipeline being destroyed
+                if (!has_next<I>::value && discard_output_.load(::std::memory_order_acquire))
+                    return;
+                ::std::this_thread::yield();
+            }
+        }
+        notify_next<I>(has_next<I>{});
+    }
+
+    template < ::std::size_t I >
+    void
+    notify_next(::std::true_type const&)
+    { counters_[I + 1].notify(); }
+    template < ::std::size_t I >
+    void
+    notify_next(::std::false_type const&)
+    {}
+
+    template < ::std::size_t I >
+    auto&
+    next_queue(::std::true_type const&)
+    { return ::std::get<I + 1>(queues_); }
+    template < ::std::size_t I >
+    output_queue_type&
+    next_queue(::std::false_type const&)
+    { return output_; }
+
+    template < ::std::size_t I >
+    void
+    finish(::std::integral_constant< ::std::size_t, I > const&, ::std::true_type const&)
+    {
+        counters_[I + 1].input_done.store(true, ::std::memory_order_release);
+        counters_[I + 1].notify();
+    }
+    template < ::std::size_t I >
+    void
+    finish(::std::integral_constant< ::std::size_t, I > const&, ::std::false_type const&)
+    {}
+private:
+    using stage_queues_type = decltype(make_queues_type(::std::index_sequence_for<Stage...>{}));
+
+    ::std::tuple< Stage... >                    stages_;
+    stage_queues_type                           queues_;
+    output_queue_type                           output_;
+    ::std::array< detail::pipeline_stage_counters, stage_count >
+                                                counters_;
+    ::std::array< ::std::thread, stage_count >  threads_;
+    bool                                        closed_;
+    ::std::atomic<bool>                         discard_output_;
+};
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_PIPELINE_HPP_ */
@@ -0,0 +1,351 @@
+/*
+ * record_file.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_RECORD_FILE_HPP_
+#define PUSHKIN_UTIL_RECORD_FILE_HPP_
+
+#include <pushkin/meta/record_layout.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <utility>
+
+// POSIX only
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace psst {
+namespace util {
+
+/**
+ * Exception thrown when a record file doesn't match the expected format
+ * or schema
+ */
+class record_file_error : public ::std::runtime_error {
+public:
+    using ::std::runtime_error::runtime_error;
+};
+
+namespace detail {
+
+/**
+ * Header of a record file. All values are in the native byte order.
+ */
+struct record_file_header {
+    char            magic[8];
+    ::std::uint64_t version;
+    ::std::uint64_t schema_hash;
+    ::std::uint64_t record_size;
+    ::std::uint64_t record_count;
+    ::std::uint64_t data_offset;
+};
+
+constexpr char record_file_magic[8]{ 'P', 'S', 'S', 'T', 'R', 'E', 'C', 0 };
+constexpr ::std::uint64_t record_file_version       = 1;
+/**
+ * Records start at a cache line boundary
+ */
+constexpr ::std::uint64_t record_file_data_offset   = 64;
+
+static_assert(sizeof(record_file_header) <= record_file_data_offset,
+        "Record file header doesn't fit before the data");
+
+inline record_file_header
+make_record_file_header(::std::uint64_t schema_hash, ::std::uint64_t record_size,
+        ::std::uint64_t record_count) noexcept
+{
+    record_file_header header{ {}, record_file_version, schema_hash,
+        record_size, record_count, record_file_data_offset };
+    ::std::memcpy(header.magic, record_file_magic, sizeof(header.magic));
+    return header;
+}
+
+}  /* namespace detail */
+
+/**
+ * Writer of a flat file of records with a layout described by a type
+ * tuple of field types.
+ *
+ * Usage:
+ * @code
+ * using trade = type_tuple<::std::int64_t, double, ::std::uint32_t>;
+ * record_writer<trade> writer{ "trades.bin" };
+ * writer.append(timestamp, price, qty);
+ * writer.close();
+ * @endcode
+ */
+template < typename Schema >
+class record_writer {
+public:
+    using layout = meta::record_layout<Schema>;
+public:
+    /**
+     * Create or truncate a record file
+     * @throws record_file_error if the file cannot be opened
+     */
+    explicit
+    record_writer(::std::string const& path)
+        : file_{ path, ::std::ios::binary | ::std::ios::trunc | ::std::ios::out },
+          count_{0}
+    {
+        if (!file_)
+            throw record_file_error{ "Failed to open record file " + path };
+        write_header();
+        char const padding[detail::record_file_data_offset]{};
+        file_.write(padding, detail::record_file_data_offset - sizeof(detail::record_file_header));
+        check();
+    }
+    record_writer(record_writer const&) = delete;
+    record_writer&
+    operator = (record_writer const&) = delete;
+    ~record_writer()
+    {
+        try {
+            close();
+        } catch (...) {}
+    }
+
+    /**
+     * Append a record, arguments are converted to the field types
+     */
+    template < typename ... Args >
+    void
+    append(Args const& ... args)
+    {
+        static_assert(sizeof ... (Args) == layout::field_count,
+                "Expected a value for each record field");
+        write_row(::std::forward_as_tuple(args...),
+                ::std::make_index_sequence<layout::field_count>{});
+    }
+
+    ::std::size_t
+    size() const noexcept
+    { return count_; }
+
+    /**
+     * Write the record count to the header and close the file
+     * @throws record_file_error on write error
+     */
+    void
+    close()
+    {
+        if (!file_.is_open())
+            return;
+        file_.seekp(0);
+        write_header();
+        file_.close();
+        check();
+    }
+private:
+    void
+    check()
+    {
+        if (!file_)
+            throw record_file_error{ "Failed to write record file" };
+    }
+    void
+    write_header()
+    {
+        auto header = detail::make_record_file_header(
+                layout::schema_hash, layout::size, count_);
+        file_.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    }
+
+    template < ::std::size_t I, typename T >
+    static void
+    store(unsigned char* row, T const& value)
+    {
+        typename layout::template field_type<I> const field = value;
+        ::std::memcpy(row + layout::template offset<I>, &field, sizeof(field));
+    }
+
+    template < typename Tuple, ::std::size_t ... I >
+    void
+    write_row(Tuple const& values, ::std::index_sequence<I...> const&)
+    {
+        unsigned char row[layout::size]{};
+        (void)::std::initializer_list<int>{ (store<I>(row, ::std::get<I>(values)), 0)... };
+        file_.write(reinterpret_cast<char const*>(row), layout::size);
+        check();
+        ++count_;
+    }
+
+    ::std::ofstream file_;
+    ::std::size_t   count_;
+};
+
+/**
+ * Read-only memory mapped view of a record file. Fields are read in place
+ * from the mapped file, nothing is parsed or copied on open.
+ *
+ * Opening a file checks the header, the schema hash and the file size.
+ *
+ * Usage:
+ * @code
+ * record_view<trade> trades{ "trades.bin" };
+ * double total = 0;
+ * for (::std::size_t i = 0; i < trades.size(); ++i)
+ *     total += trades.get<1>(i);
+ * @endcode
+ */
+template < typename Schema >
+class record_view {
+public:
+    using layout = meta::record_layout<Schema>;
+    template < ::std::size_t I >
+    using field_type = typename layout::template field_type<I>;
+public:
+    /**
+     * Map a record file
+     * @throws ::std::system_error if the file cannot be opened or mapped
+     * @throws record_file_error if the file format or schema doesn't match
+     */
+    explicit
+    record_view(::std::string const& path)
+        : map_{nullptr}, map_size_{0}, data_{nullptr}, count_{0}
+    {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            throw ::std::system_error{ errno, ::std::generic_category(), "open " + path };
+        struct ::stat st;
+        if (::fstat(fd, &st) != 0) {
+            auto err = errno;
+            ::close(fd);
+            throw ::std::system_error{ err, ::std::generic_category(), "stat " + path };
+        }
+        map_size_ = static_cast<::std::size_t>(st.st_size);
+        if (map_size_ < sizeof(detail::record_file_header)) {
+            ::close(fd);
+            throw record_file_error{ "Record file " + path + " is too short" };
+        }
+        map_ = ::mmap(nullptr, map_size_, PROT_READ, MAP_SHARED, fd, 0);
+        auto err = errno;
+        ::close(fd);
+        if (map_ == MAP_FAILED) {
+            map_ = nullptr;
+            throw ::std::system_error{ err, ::std::generic_category(), "mmap " + path };
+        }
+        try {
+            check_header(path);
+        } catch (...) {
+            unmap();
+            throw;
+        }
+    }
+    record_view(record_view const&) = delete;
+    record_view&
+    operator = (record_view const&) = delete;
+    record_view(record_view&& rhs) noexcept
+        : map_{rhs.map_}, map_size_{rhs.map_size_}, data_{rhs.data_}, count_{rhs.count_}
+    {
+        rhs.map_ = nullptr;
+        rhs.data_ = nullptr;
+        rhs.count_ = 0;
+    }
+    record_view&
+    operator = (record_view&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            unmap();
+            ::std::swap(map_, rhs.map_);
+            ::std::swap(map_size_, rhs.map_size_);
+            ::std::swap(data_, rhs.data_);
+            ::std::swap(count_, rhs.count_);
+        }
+        return *this;
+    }
+    ~record_view()
+    {
+        unmap();
+    }
+
+    /**
+     * Number of records
+     */
+    ::std::size_t
+    size() const noexcept
+    { return count_; }
+    bool
+    empty() const noexcept
+    { return count_ == 0; }
+
+    /**
+     * Read a field of a record
+     * @throws ::std::out_of_range if the row is out of range
+     */
+    template < ::std::size_t I >
+    field_type<I>
+    get(::std::size_t row) const
+    {
+        if (row >= count_)
+            throw ::std::out_of_range{ "Record index out of range" };
+        return get_unchecked<I>(row);
+    }
+    template < ::std::size_t I >
+    field_type<I>
+    get_unchecked(::std::size_t row) const noexcept
+    {
+        field_type<I> value;
+        ::std::memcpy(&value, data_ + row * layout::size + layout::template offset<I>,
+                sizeof(value));
+        return value;
+    }
+
+    /**
+     * Start of the records, layout::size bytes per record
+     */
+    unsigned char const*
+    data() const noexcept
+    { return data_; }
+private:
+    void
+    check_header(::std::string const& path)
+    {
+        detail::record_file_header header;
+        ::std::memcpy(&header, map_, sizeof(header));
+        if (::std::memcmp(header.magic, detail::record_file_magic, sizeof(header.magic)) != 0
+                || header.version != detail::record_file_version)
+            throw record_file_error{ path + " is not a record file" };
+        if (header.schema_hash != layout::schema_hash || header.record_size != layout::size)
+            throw record_file_error{ "Record file " + path + " schema mismatch" };
+        if (header.data_offset > map_size_
+                || (map_size_ - header.data_offset) / layout::size < header.record_count)
+            throw record_file_error{ "Record file " + path + " is truncated" };
+        data_ = static_cast<unsigned char const*>(map_) + header.data_offset;
+        count_ = static_cast<::std::size_t>(header.record_count);
+    }
+    void
+    unmap() noexcept
+    {
+        if (map_) {
+            ::munmap(map_, map_size_);
+            map_ = nullptr;
+            data_ = nullptr;
+            count_ = 0;
+        }
+    }
+
+    void*                   map_;
+    ::std::size_t           map_size_;
+    unsigned char const*    data_;
+    ::std::size_t           count_;
+};
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_RECORD_FILE_HPP_ */
@@ -0,0 +1,317 @@
+/*
+ * ring_buffer.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_RING_BUFFER_HPP_
+#define PUSHKIN_UTIL_RING_BUFFER_HPP_
+
+#include <pushkin/util/cache_line.hpp>
+#include <pushkin/util/construct.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace psst {
+namespace util {
+
+namespace detail {
+
+template < typename T >
+struct ring_slot {
+    alignas(T) unsigned char data[sizeof(T)];
+
+    T*
+    get() noexcept
+    { return reinterpret_cast<T*>(data); }
+};
+
+}  /* namespace detail */
+
+/**
+ * Bounded lock-free single producer single consumer queue.
+ * Values are stored in place, the buffer is allocated once on
+ * construction.
+ */
+template < typename T, ::std::size_t Capacity >
+class spsc_ring_buffer {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+            "Capacity must be a power of two");
+public:
+    using value_type    = T;
+    static constexpr ::std::size_t capacity = Capacity;
+    static constexpr ::std::size_t npos = ::std::numeric_limits<::std::size_t>::max();
+public:
+    spsc_ring_buffer()
+        : slots_{ new slot_type[Capacity] },
+          head_{0}, cached_tail_{0},
+          tail_{0}, cached_head_{0} {}
+    spsc_ring_buffer(spsc_ring_buffer const&) = delete;
+    spsc_ring_buffer&
+    operator = (spsc_ring_buffer const&) = delete;
+    ~spsc_ring_buffer()
+    {
+        // consume reloads the tail only when the cached one is reached
+        while (consume([](T&){}) > 0);
+    }
+
+    /**
+     * Construct a value at the back of the queue. Producer side.
+     * @return false if the queue is full
+     */
+    template < typename ... Args >
+    bool
+    try_emplace(Args&& ... args)
+    {
+        auto tail = tail_.load(::std::memory_order_relaxed);
+        if (tail - cached_head_ == Capacity) {
+            cached_head_ = head_.load(::std::memory_order_acquire);
+            if (tail - cached_head_ == Capacity)
+                return false;
+        }
+        construct_in_place<T>(slots_[tail & mask].get(), ::std::forward<Args>(args)...);
+        tail_.store(tail + 1, ::std::memory_order_release);
+        return true;
+    }
+    bool
+    try_push(T const& val)
+    { return try_emplace(val); }
+    bool
+    try_push(T&& val)
+    { return try_emplace(::std::move(val)); }
+
+    /**
+     * Pop a value from the front of the queue. Consumer side.
+     * @return false if the queue is empty
+     */
+    bool
+    try_pop(T& val)
+    {
+        return consume([&](T& v) { val = ::std::move(v); }, 1) == 1;
+    }
+
+    /**
+     * Call a function for up to max values in the front of the queue, in
+     * place, and remove them. Consumer side.
+     * @return Number of values consumed
+     */
+    template < typename Func >
+    ::std::size_t
+    consume(Func&& func, ::std::size_t max = npos)
+    {
+        auto head = head_.load(::std::memory_order_relaxed);
+        if (head == cached_tail_) {
+            cached_tail_ = tail_.load(::std::memory_order_acquire);
+            if (head == cached_tail_)
+                return 0;
+        }
+        auto count = cached_tail_ - head;
+        if (count > max)
+            count = max;
+        for (::std::size_t i = 0; i < count; ++i) {
+            T* val = slots_[(head + i) & mask].get();
+            try {
+                func(*val);
+            } catch (...) {
+                // The value is consumed even if the handler throws
+                val->~T();
+                head_.store(head + i + 1, ::std::memory_order_release);
+                throw;
+            }
+            val->~T();
+        }
+        head_.store(head + count, ::std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * Approximate number of values in the queue
+     */
+    ::std::size_t
+    size() const noexcept
+    {
+        auto head = head_.load(::std::memory_order_acquire);
+        auto tail = tail_.load(::std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+    bool
+    empty() const noexcept
+    { return size() == 0; }
+private:
+    using slot_type = detail::ring_slot<T>;
+    static constexpr ::std::size_t mask = Capacity - 1;
+
+    ::std::unique_ptr<slot_type[]>  slots_;
+    // Consumer data
+    alignas(cache_line_size)
+    ::std::atomic<::std::size_t>    head_;
+    ::std::size_t                   cached_tail_;
+    // Producer data
+    alignas(cache_line_size)
+    ::std::atomic<::std::size_t>    tail_;
+    ::std::size_t                   cached_head_;
+};
+
+/**
+ * Bounded lock-free multiple producer single consumer queue.
+ * Each slot carries a sequence number, producers claim slots with a CAS
+ * on the tail, the consumer doesn't need atomic read-modify-write
+ * operations.
+ */
+template < typename T, ::std::size_t Capacity >
+class mpsc_ring_buffer {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+            "Capacity must be a power of two");
+public:
+    using value_type    = T;
+    static constexpr ::std::size_t capacity = Capacity;
+    static constexpr ::std::size_t npos = ::std::numeric_limits<::std::size_t>::max();
+public:
+    mpsc_ring_buffer()
+        : cells_{ new cell[Capacity] },
+          head_{0}, tail_{0}
+    {
+        for (::std::size_t i = 0; i < Capacity; ++i)
+            cells_[i].sequence.store(i, ::std::memory_order_relaxed);
+    }
+    mpsc_ring_buffer(mpsc_ring_buffer const&) = delete;
+    mpsc_ring_buffer&
+    operator = (mpsc_ring_buffer const&) = delete;
+    ~mpsc_ring_buffer()
+    {
+        while (consume([](T&){}) > 0);
+    }
+
+    /**
+     * Construct a value at the back of the queue. Thread safe.
+     * @return false if the queue is full
+     */
+    template < typename ... Args >
+    bool
+    try_emplace(Args&& ... args)
+    {
+        auto pos = tail_.load(::std::memory_order_relaxed);
+        cell* c = nullptr;
+        while (true) {
+            c = &cells_[pos & mask];
+            auto seq = c->sequence.load(::std::memory_order_acquire);
+            auto diff = static_cast<::std::ptrdiff_t>(seq) - static_cast<::std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, ::std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load(::std::memory_order_relaxed);
+            }
+        }
+        try {
+            construct_in_place<T>(c->slot.get(), ::std::forward<Args>(args)...);
+        } catch (...) {
+            // The slot is claimed, publish it empty so that the consumer
+            // skips it instead of waiting for it forever
+            c->constructed = false;
+            c->sequence.store(pos + 1, ::std::memory_order_release);
+            throw;
+        }
+        c->constructed = true;
+        c->sequence.store(pos + 1, ::std::memory_order_release);
+        return true;
+    }
+    bool
+    try_push(T const& val)
+    { return try_emplace(val); }
+    bool
+    try_push(T&& val)
+    { return try_emplace(::std::move(val)); }
+
+    /**
+     * Pop a value from the front of the queue. Consumer side.
+     * @return false if the queue is empty
+     */
+    bool
+    try_pop(T& val)
+    {
+        return consume([&](T& v) { val = ::std::move(v); }, 1) == 1;
+    }
+
+    /**
+     * Call a function for up to max values in the front of the queue, in
+     * place, and remove them. Consumer side.
+     * @return Number of values consumed
+     */
+    template < typename Func >
+    ::std::size_t
+    consume(Func&& func, ::std::size_t max = npos)
+    {
+        auto head = head_.load(::std::memory_order_relaxed);
+        ::std::size_t count = 0;
+        for (; count < max; ++head) {
+            cell& c = cells_[head & mask];
+            if (c.sequence.load(::std::memory_order_acquire) != head + 1)
+                break;
+            if (!c.constructed) {
+                // Constructor of the value threw
+                c.sequence.store(head + Capacity, ::std::memory_order_release);
+                continue;
+            }
+            ++count;
+            T* val = c.slot.get();
+            try {
+                func(*val);
+            } catch (...) {
+                // The value is consumed even if the handler throws
+                val->~T();
+                c.sequence.store(head + Capacity, ::std::memory_order_release);
+                head_.store(head + 1, ::std::memory_order_release);
+                throw;
+            }
+            val->~T();
+            c.sequence.store(head + Capacity, ::std::memory_order_release);
+        }
+        head_.store(head, ::std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * Approximate number of values in the queue
+     */
+    ::std::size_t
+    size() const noexcept
+    {
+        auto head = head_.load(::std::memory_order_acquire);
+        auto tail = tail_.load(::std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+    bool
+    empty() const noexcept
+    { return size() == 0; }
+private:
+    struct cell {
+        cell() : sequence{0}, constructed{false}, slot{} {}
+
+        ::std::atomic<::std::size_t>    sequence;
+        // Published by the sequence
+        bool                            constructed;
+        detail::ring_slot<T>            slot;
+    };
+    static constexpr ::std::size_t mask = Capacity - 1;
+
+    ::std::unique_ptr<cell[]>       cells_;
+    alignas(cache_line_size)
+    ::std::atomic<::std::size_t>    head_;
+    alignas(cache_line_size)
+    ::std::atomic<::std::size_t>    tail_;
+};
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_RING_BUFFER_HPP_ */
@@ -0,0 +1,287 @@
+/*
+ * rpc_dispatcher.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_RPC_DISPATCHER_HPP_
+#define PUSHKIN_UTIL_RPC_DISPATCHER_HPP_
+
+#include <pushkin/meta/function_traits.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+namespace psst {
+namespace util {
+
+namespace detail {
+
+template < typename T >
+struct is_wire_string : ::std::false_type {};
+
+#if __cplusplus >= 201703L
+template < typename CharT, typename Traits >
+struct is_wire_string< ::std::basic_string_view<CharT, Traits> > : ::std::true_type {};
+#endif
+
+}  /* namespace detail */
+
+/**
+ * Wire representation of a handler argument.
+ *
+ * Trivially copyable default constructible values are stored as their
+ * object representation, string views as a 32-bit length followed by
+ * the characters. Specialize for other types.
+ */
+template < typename T, typename Enable = void >
+struct wire_traits;
+
+template < typename T >
+struct wire_traits< T, ::std::enable_if_t<
+        ::std::is_trivially_copyable<T>::value &&
+        ::std::is_default_constructible<T>::value &&
+        !detail::is_wire_string<T>::value > > {
+    static constexpr ::std::size_t npos = ::std::numeric_limits<::std::size_t>::max();
+
+    /**
+     * Number of bytes the value occupies in the buffer, npos if the buffer
+     * is too short.
+     */
+    static ::std::size_t
+    size(char const*, ::std::size_t avail) noexcept
+    {
+        return avail >= sizeof(T) ? sizeof(T) : npos;
+    }
+    static T
+    read(char const* data) noexcept
+    {
+        T value{};
+        ::std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+    static ::std::size_t
+    encoded_size(T const&) noexcept
+    {
+        return sizeof(T);
+    }
+    static char*
+    write(char* out, T const& val) noexcept
+    {
+        ::std::memcpy(out, &val, sizeof(T));
+        return out + sizeof(T);
+    }
+};
+
+#if __cplusplus >= 201703L
+/**
+ * String views are returned pointing into the buffer, the characters are
+ * never copied. Only narrow characters are supported, the characters
+ * follow the length at an arbitrary offset, so wider characters would be
+ * misaligned.
+ */
+template < typename CharT, typename Traits >
+struct wire_traits< ::std::basic_string_view<CharT, Traits> > {
+    static_assert(sizeof(CharT) == 1,
+            "Only string views of single byte characters can refer to the buffer");
+
+    using value_type    = ::std::basic_string_view<CharT, Traits>;
+    using length_type   = ::std::uint32_t;
+    static constexpr ::std::size_t npos = ::std::numeric_limits<::std::size_t>::max();
+
+    static ::std::size_t
+    size(char const* data, ::std::size_t avail) noexcept
+    {
+        if (avail < sizeof(length_type))
+            return npos;
+        auto sz = sizeof(length_type) + length(data) * sizeof(CharT);
+        return avail >= sz ? sz : npos;
+    }
+    static value_type
+    read(char const* data) noexcept
+    {
+        return value_type{
+            reinterpret_cast<CharT const*>(data + sizeof(length_type)),
+            length(data)};
+    }
+    static ::std::size_t
+    encoded_size(value_type const& val) noexcept
+    {
+        return sizeof(length_type) + val.size() * sizeof(CharT);
+    }
+    static char*
+    write(char* out, value_type const& val) noexcept
+    {
+        auto len = static_cast<length_type>(val.size());
+        ::std::memcpy(out, &len, sizeof(length_type));
+        out += sizeof(length_type);
+        ::std::memcpy(out, val.data(), val.size() * sizeof(CharT));
+        return out + val.size() * sizeof(CharT);
+    }
+private:
+    static ::std::size_t
+    length(char const* data) noexcept
+    {
+        length_type len;
+        ::std::memcpy(&len, data, sizeof(length_type));
+        return len;
+    }
+};
+#endif /* __cplusplus >= 201703L */
+
+/**
+ * Number of bytes needed to encode the arguments
+ */
+template < typename ... Args >
+::std::size_t
+encoded_size(Args const& ... args) noexcept
+{
+    ::std::size_t sz = 0;
+    (void)::std::initializer_list<int>{
+        (sz += wire_traits< ::std::decay_t<Args> >::encoded_size(args), 0)... };
+    return sz;
+}
+
+/**
+ * Encode arguments in the format expected by the rpc_dispatcher.
+ * The output buffer must be at least encoded_size(args...) bytes.
+ * @return Pointer past the last byte written
+ */
+template < typename ... Args >
+char*
+encode(char* out, Args const& ... args) noexcept
+{
+    (void)::std::initializer_list<int>{
+        (out = wire_traits< ::std::decay_t<Args> >::write(out, args), 0)... };
+    return out;
+}
+
+namespace detail {
+
+template < typename Arg >
+using wire_type = wire_traits< ::std::decay_t<Arg> >;
+
+template < typename Arg >
+bool
+advance_arg(::std::size_t const& offset, ::std::size_t& next,
+        char const* data, ::std::size_t size) noexcept
+{
+    if (offset > size)
+        return false;
+    auto sz = wire_type<Arg>::size(data + offset, size - offset);
+    if (sz == wire_type<Arg>::npos)
+        return false;
+    next = offset + sz;
+    return true;
+}
+
+/**
+ * Find argument offsets in a single pass over the buffer, then read every
+ * argument directly into the handler call.
+ */
+template < typename Handler, typename ... Args, ::std::size_t ... Indexes >
+bool
+decode_and_call(Handler& handler, meta::type_tuple<Args...> const&,
+        ::std::index_sequence<Indexes...> const&,
+        char const* data, ::std::size_t size)
+{
+    (void)data;    // unused for handlers without arguments
+    ::std::size_t offsets[sizeof ... (Args) + 1]{ 0 };
+    bool ok = true;
+    (void)::std::initializer_list<int>{
+        (ok = ok && advance_arg<Args>(offsets[Indexes], offsets[Indexes + 1], data, size), 0)... };
+    if (!ok || offsets[sizeof ... (Args)] != size)
+        return false;
+    handler(wire_type<Args>::read(data + offsets[Indexes])...);
+    return true;
+}
+
+}  /* namespace detail */
+
+/**
+ * Dispatches encoded calls to a set of handlers. The opcode of a handler
+ * is its index in the handler list.
+ *
+ * Argument types of a handler are deduced via function_traits, so
+ * handlers are functions, member function pointers bound in lambdas or
+ * function objects with a single non-template call operator.
+ *
+ * Usage:
+ * @code
+ * auto dispatcher = make_rpc_dispatcher(
+ *         [](int a, double b) { ... },
+ *         [](std::string_view name) { ... });
+ * dispatcher.dispatch(opcode, buffer, size);
+ * @endcode
+ */
+template < typename ... Handlers >
+class rpc_dispatcher {
+    static_assert(sizeof ... (Handlers) > 0, "Dispatcher requires at least one handler");
+public:
+    using opcode_type = ::std::size_t;
+    static constexpr ::std::size_t size = sizeof ... (Handlers);
+public:
+    explicit
+    rpc_dispatcher(Handlers ... handlers)
+        : handlers_{ ::std::move(handlers)... } {}
+
+    /**
+     * Decode the arguments and call the handler for the opcode.
+     * @return false if the opcode is unknown or the buffer doesn't match
+     *         the handler's arguments
+     */
+    bool
+    dispatch(opcode_type opcode, char const* data, ::std::size_t sz)
+    {
+        return dispatch(opcode, data, sz,
+                ::std::index_sequence_for<Handlers...>{});
+    }
+private:
+    using handlers_tuple    = ::std::tuple<Handlers...>;
+    using thunk_type        = bool(*)(handlers_tuple&, char const*, ::std::size_t);
+
+    template < ::std::size_t ... Indexes >
+    bool
+    dispatch(opcode_type opcode, char const* data, ::std::size_t sz,
+            ::std::index_sequence<Indexes...> const&)
+    {
+        static constexpr thunk_type table[]{ &call_handler<Indexes>... };
+        if (opcode >= size)
+            return false;
+        return table[opcode](handlers_, data, sz);
+    }
+
+    template < ::std::size_t N >
+    static bool
+    call_handler(handlers_tuple& handlers, char const* data, ::std::size_t sz)
+    {
+        using handler_type  = typename ::std::tuple_element<N, handlers_tuple>::type;
+        using args          = meta::function_args_t<handler_type>;
+        return detail::decode_and_call(::std::get<N>(handlers), args{},
+                ::std::make_index_sequence<args::size>{}, data, sz);
+    }
+
+    handlers_tuple handlers_;
+};
+
+template < typename ... Handlers >
+rpc_dispatcher< ::std::decay_t<Handlers>... >
+make_rpc_dispatcher(Handlers&& ... handlers)
+{
+    return rpc_dispatcher< ::std::decay_t<Handlers>... >{
+        ::std::forward<Handlers>(handlers)... };
+}
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_RPC_DISPATCHER_HPP_ */
@@ -0,0 +1,279 @@
+/*
+ * state_machine.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_STATE_MACHINE_HPP_
+#define PUSHKIN_UTIL_STATE_MACHINE_HPP_
+
+#include <pushkin/meta/type_map.hpp>
+#include <pushkin/meta/type_id.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace psst {
+namespace util {
+
+/**
+ * Action type for transitions that don't do anything
+ */
+struct no_action {};
+
+/**
+ * Transition description to build a transition map
+ */
+template < typename State, typename Event, typename Next, typename Action = no_action >
+struct transition {};
+
+//@{
+/**
+ * Metafunction to build a type_map of transitions.
+ * Keys are type_pair<State, Event>, values are type_pair<Next, Action>.
+ */
+template < typename ... Transitions >
+struct make_transition_map;
+
+template < typename ... State, typename ... Event, typename ... Next, typename ... Action >
+struct make_transition_map< transition<State, Event, Next, Action>... > {
+    using type = meta::type_map<
+            meta::type_tuple< meta::type_pair<State, Event>... >,
+            meta::type_tuple< meta::type_pair<Next, Action>... > >;
+};
+
+template < typename ... Transitions >
+using make_transition_map_t = typename make_transition_map<Transitions...>::type;
+//@}
+
+namespace detail {
+
+template < typename Keys, typename Values >
+struct fsm_types;
+
+template < typename ... State, typename ... Event, typename ... Next, typename ... Action >
+struct fsm_types< meta::type_tuple< meta::type_pair<State, Event>... >,
+        meta::type_tuple< meta::type_pair<Next, Action>... > > {
+    using states        = meta::unique_t< meta::type_tuple<State..., Next...> >;
+    using events        = meta::unique_t< meta::type_tuple<Event...> >;
+    using initial_state = meta::front_t<State...>;
+};
+
+template < typename Context >
+struct fsm_context {
+    template < typename ... Args >
+    explicit
+    fsm_context(Args&& ... args)
+        : context_{ ::std::forward<Args>(args)... } {}
+
+    Context&
+    context()
+    { return context_; }
+    Context const&
+    context() const
+    { return context_; }
+private:
+    Context context_;
+};
+
+template <>
+struct fsm_context<void> {};
+
+template < typename Action, typename Event, typename Context >
+struct fsm_action {
+    static bool
+    call(fsm_context<Context>& ctx, void const* event)
+    {
+        Action{}(ctx.context(), *static_cast<Event const*>(event));
+        return true;
+    }
+};
+
+template < typename Action, typename Event >
+struct fsm_action< Action, Event, void > {
+    static bool
+    call(fsm_context<void>&, void const* event)
+    {
+        Action{}(*static_cast<Event const*>(event));
+        return true;
+    }
+};
+
+template < typename Event, typename Context >
+struct fsm_action< no_action, Event, Context > {
+    static bool
+    call(fsm_context<Context>&, void const*)
+    {
+        return true;
+    }
+};
+
+template < typename Event >
+struct fsm_action< no_action, Event, void > {
+    static bool
+    call(fsm_context<void>&, void const*)
+    {
+        return true;
+    }
+};
+
+template < typename Context >
+bool
+fsm_unhandled(fsm_context<Context>&, void const*)
+{
+    return false;
+}
+
+}  /* namespace detail */
+
+/**
+ * A state machine generated from a type_map of transitions.
+ *
+ * The transition table is a dense [state][event] table of action thunks
+ * and next state indexes built at compile time. Processing an event is a
+ * table load and an indirect call.
+ *
+ * States and events are types, actions are default constructible
+ * function objects, called as `Action{}(event)` or, if a Context type is
+ * specified, `Action{}(context, event)`. The initial state is the source
+ * state of the first transition.
+ *
+ * Usage:
+ * @code
+ * using connection_fsm = state_machine< make_transition_map_t<
+ *     transition< idle,       connect,    connecting, start_connect >,
+ *     transition< connecting, connected,  online >,
+ *     transition< online,     disconnect, idle,       close_socket > >,
+ *     connection >;
+ * connection_fsm fsm{ socket };
+ * fsm.process_event(connect{});
+ * @endcode
+ */
+template < typename TransitionMap, typename Context = void >
+class state_machine : private detail::fsm_context<Context> {
+    using types         = detail::fsm_types<
+            typename TransitionMap::key_types, typename TransitionMap::value_types >;
+    using context_base  = detail::fsm_context<Context>;
+public:
+    using transitions   = TransitionMap;
+    using states        = typename types::states;
+    using events        = typename types::events;
+    using initial_state = typename types::initial_state;
+    using state_index   = meta::smallest_unsigned_t<states::size>;
+
+    template < typename State >
+    static constexpr state_index state_index_of = meta::dense_type_id_v<State, states>;
+public:
+    state_machine()
+        : context_base{},
+          state_{ state_index_of<initial_state> } {}
+
+    template < typename Arg, typename ... Args,
+        typename = ::std::enable_if_t<
+            !::std::is_same< ::std::decay_t<Arg>, state_machine >::value > >
+    explicit
+    state_machine(Arg&& arg, Args&& ... args)
+        : context_base{ ::std::forward<Arg>(arg), ::std::forward<Args>(args)... },
+          state_{ state_index_of<initial_state> } {}
+
+    /**
+     * Process an event
+     * @return false if there is no transition for the event in the current
+     *         state, the state is not changed then.
+     */
+    template < typename Event >
+    bool
+    process_event(Event const& event)
+    {
+        constexpr auto event_index = meta::dense_type_id_v<Event, events>;
+        auto const& entry = transition_table()[state_ * events::size + event_index];
+        auto handled = entry.action(*this, &event);
+        state_ = entry.next;
+        return handled;
+    }
+
+    state_index
+    current_state() const noexcept
+    { return state_; }
+
+    template < typename State >
+    bool
+    is_in_state() const noexcept
+    { return state_ == state_index_of<State>; }
+
+    void
+    reset() noexcept
+    { state_ = state_index_of<initial_state>; }
+
+    template < typename C = Context,
+            typename = ::std::enable_if_t< !::std::is_void<C>::value > >
+    C&
+    context()
+    { return context_base::context(); }
+    template < typename C = Context,
+            typename = ::std::enable_if_t< !::std::is_void<C>::value > >
+    C const&
+    context() const
+    { return context_base::context(); }
+private:
+    using action_type = bool(*)(context_base&, void const*);
+
+    struct table_entry {
+        action_type action;
+        state_index next;
+    };
+
+    template < ::std::size_t State, ::std::size_t Event,
+        bool Found = meta::index_of< meta::type_pair<
+                typename states::template type<State>,
+                typename events::template type<Event> >,
+            typename transitions::key_types >::found >
+    struct table_cell {
+        static constexpr table_entry
+        value()
+        {
+            return table_entry{ &detail::fsm_unhandled<Context>, State };
+        }
+    };
+
+    template < ::std::size_t State, ::std::size_t Event >
+    struct table_cell< State, Event, true > {
+        using event_type    = typename events::template type<Event>;
+        using target        = typename transitions::value_types::template type<
+                meta::index_of< meta::type_pair<
+                    typename states::template type<State>, event_type >,
+                    typename transitions::key_types >::value >;
+
+        static constexpr table_entry
+        value()
+        {
+            return table_entry{
+                &detail::fsm_action<typename target::value_type, event_type, Context>::call,
+                state_index_of<typename target::key_type> };
+        }
+    };
+
+    template < ::std::size_t ... Flat >
+    static table_entry const*
+    transition_table(::std::index_sequence<Flat...> const&)
+    {
+        static constexpr table_entry table[]{
+            table_cell< Flat / events::size, Flat % events::size >::value()... };
+        return table;
+    }
+
+    static table_entry const*
+    transition_table()
+    {
+        return transition_table(
+                ::std::make_index_sequence< states::size * events::size >{});
+    }
+
+    state_index state_;
+};
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_STATE_MACHINE_HPP_ */
@@ -0,0 +1,210 @@
+/*
+ * static_index_set.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_STATIC_INDEX_SET_HPP_
+#define PUSHKIN_UTIL_STATIC_INDEX_SET_HPP_
+
+#include <pushkin/meta/algorithm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace psst {
+namespace util {
+
+namespace detail {
+
+inline ::std::size_t
+trailing_ones(::std::size_t value) noexcept
+{
+#if defined(__GNUC__)
+    return static_cast<::std::size_t>(__builtin_ctzll(~static_cast<unsigned long long>(value)));
+#else
+    ::std::size_t count = 0;
+    for (; value & 1; value >>= 1)
+        ++count;
+    return count;
+#endif
+}
+
+/**
+ * Sorted values in the Eytzinger (BFS) order, 1-based, with the rank of
+ * each node. ranks[0] is the number of values.
+ */
+template < typename T, ::std::size_t N >
+struct eytzinger_layout {
+    meta::detail::constexpr_array<T, N + 1>               values;
+    meta::detail::constexpr_array<::std::size_t, N + 1>   ranks;
+};
+
+template < typename T, ::std::size_t N >
+constexpr ::std::size_t
+eytzinger_fill(T const* sorted, eytzinger_layout<T, N>& layout,
+        ::std::size_t i, ::std::size_t k) noexcept
+{
+    if (k <= N) {
+        i = eytzinger_fill(sorted, layout, i, 2 * k);
+        layout.values[k] = sorted[i];
+        layout.ranks[k] = i++;
+        i = eytzinger_fill(sorted, layout, i, 2 * k + 1);
+    }
+    return i;
+}
+
+template < typename T, T ... Values >
+constexpr eytzinger_layout<T, sizeof ... (Values)>
+make_eytzinger_layout() noexcept
+{
+    T const sorted[]{ Values..., T{} };
+    eytzinger_layout<T, sizeof ... (Values)> layout{};
+    eytzinger_fill(sorted, layout, 0, 1);
+    layout.ranks[0] = sizeof ... (Values);
+    return layout;
+}
+
+}  /* namespace detail */
+
+template < typename Sequence, ::std::size_t LinearThreshold = 32 >
+class static_index_set;
+
+/**
+ * A set of integer values known at compile time with runtime lookup.
+ * Values are sorted and deduplicated at compile time.
+ *
+ * Sets of up to LinearThreshold values are searched with a linear scan
+ * without branches, that compilers vectorize. Larger sets are searched
+ * with a branchless binary search in a table in the Eytzinger layout.
+ *
+ * Usage:
+ * @code
+ * using retryable = static_index_set< ::std::integer_sequence<int,
+ *         EAGAIN, EINTR, ETIMEDOUT> >;
+ * if (retryable::contains(err)) { ... }
+ * @endcode
+ */
+template < typename T, T ... Values, ::std::size_t LinearThreshold >
+class static_index_set< ::std::integer_sequence<T, Values...>, LinearThreshold > {
+public:
+    using value_type    = T;
+    using sequence      = meta::sort_t<
+            meta::unique_t< ::std::integer_sequence<T, Values...> > >;
+
+    static constexpr ::std::size_t size     = sequence::size();
+    static constexpr ::std::size_t npos     = ::std::numeric_limits<::std::size_t>::max();
+    static constexpr bool linear_search     = size <= LinearThreshold;
+public:
+    /**
+     * Check if the value is in the set
+     */
+    static bool
+    contains(T value) noexcept
+    {
+        return contains(value, search_tag{});
+    }
+    /**
+     * Number of values in the set that are less than the value, that is
+     * the index of the value in the sorted sequence if it's in the set.
+     */
+    static ::std::size_t
+    rank(T value) noexcept
+    {
+        return rank(value, search_tag{});
+    }
+    /**
+     * Index of the value in the sorted sequence or npos if it's not in
+     * the set
+     */
+    static ::std::size_t
+    find(T value) noexcept
+    {
+        auto r = rank(value);
+        return r < size && sorted()[r] == value ? r : npos;
+    }
+private:
+    using search_tag = ::std::integral_constant<bool, linear_search>;
+    using linear_tag = ::std::true_type;
+    using binary_tag = ::std::false_type;
+
+    static T const*
+    sorted() noexcept
+    {
+        return sorted(sequence{});
+    }
+    template < T ... Sorted >
+    static T const*
+    sorted(::std::integer_sequence<T, Sorted...> const&) noexcept
+    {
+        static constexpr T values[]{ Sorted..., T{} };
+        return values;
+    }
+
+    static bool
+    contains(T value, linear_tag const&) noexcept
+    {
+        auto values = sorted();
+        ::std::size_t found = 0;
+        for (::std::size_t i = 0; i < size; ++i)
+            found += values[i] == value;
+        return found != 0;
+    }
+    static ::std::size_t
+    rank(T value, linear_tag const&) noexcept
+    {
+        auto values = sorted();
+        ::std::size_t count = 0;
+        for (::std::size_t i = 0; i < size; ++i)
+            count += values[i] < value;
+        return count;
+    }
+
+    using layout_type = detail::eytzinger_layout<T, size>;
+
+    static layout_type const&
+    layout() noexcept
+    {
+        return layout(sequence{});
+    }
+    template < T ... Sorted >
+    static layout_type const&
+    layout(::std::integer_sequence<T, Sorted...> const&) noexcept
+    {
+        static constexpr layout_type table = detail::make_eytzinger_layout<T, Sorted...>();
+        return table;
+    }
+    /**
+     * Eytzinger index of the first value not less than the value, 0 if
+     * there is no such value
+     */
+    static ::std::size_t
+    lower_bound_node(T value) noexcept
+    {
+        auto const& values = layout().values;
+        ::std::size_t k = 1;
+        while (k <= size)
+            k = 2 * k + (values[k] < value);
+        return k >> (detail::trailing_ones(k) + 1);
+    }
+    static bool
+    contains(T value, binary_tag const&) noexcept
+    {
+        auto k = lower_bound_node(value);
+        return k != 0 && layout().values[k] == value;
+    }
+    static ::std::size_t
+    rank(T value, binary_tag const&) noexcept
+    {
+        return layout().ranks[lower_bound_node(value)];
+    }
+};
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_STATIC_INDEX_SET_HPP_ */
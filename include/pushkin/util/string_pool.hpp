@@ -0,0 +1,190 @@
+/*
+ * string_pool.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_STRING_POOL_HPP_
+#define PUSHKIN_UTIL_STRING_POOL_HPP_
+
+#include <pushkin/meta/algorithm.hpp>
+#include <pushkin/meta/char_sequence.hpp>
+#include <pushkin/util/cache_line.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace psst {
+namespace util {
+
+/**
+ * Position of a string in a string pool
+ */
+struct string_handle {
+    static constexpr ::std::uint32_t npos = ::std::numeric_limits<::std::uint32_t>::max();
+
+    ::std::uint32_t offset;
+    ::std::uint32_t length;
+
+    constexpr bool
+    valid() const noexcept
+    { return offset != npos; }
+
+    constexpr bool
+    operator == (string_handle const& rhs) const noexcept
+    { return offset == rhs.offset; }
+    constexpr bool
+    operator != (string_handle const& rhs) const noexcept
+    { return offset != rhs.offset; }
+};
+
+namespace detail {
+
+template < typename Literals >
+struct string_pool_storage;
+
+/**
+ * Null-terminated literals placed one after another
+ */
+template < typename ... Lit >
+struct alignas(cache_line_size) string_pool_storage< meta::type_tuple<Lit...> > {
+    using lengths   = ::std::index_sequence< (Lit::size + 1)... >;
+    using offsets   = meta::exclusive_scan_t< lengths >;
+
+    static constexpr ::std::size_t size = meta::sum_v< lengths >;
+
+    char data[size];
+
+    constexpr string_pool_storage() noexcept
+        : data{}
+    {
+        char const* const values[]{ Lit::value... };
+        ::std::size_t const sizes[]{ Lit::size... };
+        ::std::size_t pos = 0;
+        for (::std::size_t i = 0; i < sizeof ... (Lit); ++i) {
+            for (::std::size_t j = 0; j < sizes[i]; ++j)
+                data[pos++] = values[i][j];
+            data[pos++] = 0;
+        }
+    }
+
+    /**
+     * Offsets and lengths of the strings, lengths don't rely on the
+     * terminating nulls, so strings can contain embedded nulls
+     */
+    static string_handle const*
+    handles() noexcept
+    {
+        return handles(offsets{});
+    }
+private:
+    template < ::std::size_t ... Offset >
+    static string_handle const*
+    handles(::std::index_sequence<Offset...> const&) noexcept
+    {
+        static constexpr string_handle values[]{
+            string_handle{ static_cast<::std::uint32_t>(Offset),
+                static_cast<::std::uint32_t>(Lit::size) }... };
+        return values;
+    }
+};
+
+}  /* namespace detail */
+
+/**
+ * A set of char_sequence_literal strings merged into a single contiguous
+ * cache line aligned blob at compile time. Each string has a constexpr
+ * handle, equal strings share storage, so comparing handles or pointers
+ * of interned strings compares the strings.
+ *
+ * Usage:
+ * @code
+ * using price = char_sequence_literal<'p', 'r', 'i', 'c', 'e'>;
+ * using qty   = char_sequence_literal<'q', 't', 'y'>;
+ * using names = string_pool< price, qty >;
+ *
+ * constexpr auto h = names::handle<qty>();
+ * ::std::puts(names::c_str(h));
+ * auto found = names::find(str, len);
+ * if (found == h) { ... }
+ * @endcode
+ */
+template < typename ... Lit >
+class string_pool {
+public:
+    using literals  = meta::unique_t<Lit...>;
+    static_assert(literals::size > 0, "String pool must contain at least one string");
+private:
+    using storage_type  = detail::string_pool_storage<literals>;
+public:
+    /**
+     * Number of distinct strings
+     */
+    static constexpr ::std::size_t count    = literals::size;
+    /**
+     * Size of the pool in bytes, including the terminating nulls
+     */
+    static constexpr ::std::size_t size     = storage_type::size;
+    static_assert(size < string_handle::npos, "String pool is too large");
+
+    /**
+     * Handle of a string in the pool
+     */
+    template < typename L >
+    static constexpr string_handle
+    handle() noexcept
+    {
+        static_assert(meta::index_of<L, literals>::found, "The string is not in the pool");
+        return string_handle{
+            static_cast<::std::uint32_t>(meta::nth_value_v<
+                    meta::index_of<L, literals>::value, typename storage_type::offsets >),
+            static_cast<::std::uint32_t>(L::size) };
+    }
+
+    /**
+     * Start of the pool
+     */
+    static char const*
+    data() noexcept
+    {
+        static constexpr storage_type storage{};
+        return storage.data;
+    }
+    static char const*
+    c_str(string_handle const& h) noexcept
+    { return data() + h.offset; }
+    template < typename L >
+    static char const*
+    c_str() noexcept
+    { return c_str(handle<L>()); }
+
+    /**
+     * Find a string in the pool
+     * @return Handle of the string or an invalid handle if it's not there
+     */
+    static string_handle
+    find(char const* str, ::std::size_t length) noexcept
+    {
+        auto pool = data();
+        auto handles = storage_type::handles();
+        for (::std::size_t i = 0; i < count; ++i) {
+            auto const& h = handles[i];
+            if (h.length == length && ::std::memcmp(pool + h.offset, str, length) == 0)
+                return h;
+        }
+        return string_handle{ string_handle::npos, 0 };
+    }
+    static string_handle
+    find(char const* str) noexcept
+    { return find(str, ::std::strlen(str)); }
+};
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_STRING_POOL_HPP_ */
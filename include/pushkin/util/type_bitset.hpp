@@ -0,0 +1,241 @@
+/*
+ * type_bitset.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_TYPE_BITSET_HPP_
+#define PUSHKIN_UTIL_TYPE_BITSET_HPP_
+
+#include <pushkin/meta/type_id.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace psst {
+namespace util {
+
+namespace detail {
+
+constexpr ::std::size_t
+popcount(::std::uint64_t word) noexcept
+{
+#if defined(__GNUC__)
+    return static_cast<::std::size_t>(__builtin_popcountll(word));
+#else
+    ::std::size_t count = 0;
+    for (; word; word &= word - 1)
+        ++count;
+    return count;
+#endif
+}
+
+}  /* namespace detail */
+
+template < typename Universe >
+class type_bitset;
+
+/**
+ * A set of types from a type universe, a bit per type.
+ * Replacement for ::std::set<::std::type_index>, set operations are
+ * operations on words.
+ *
+ * Usage:
+ * @code
+ * using components = type_tuple<position, velocity, sprite, collider>;
+ * using component_set = type_bitset<components>;
+ * component_set set{ type_tuple<position, velocity>{} };
+ * set.insert<sprite>();
+ * if (set.matches< type_tuple<position, velocity> >()) { ... }
+ * @endcode
+ */
+template < typename ... T >
+class type_bitset< meta::type_tuple<T...> > {
+public:
+    using universe  = meta::type_tuple<T...>;
+    using word_type = ::std::uint64_t;
+    static_assert(meta::unique_t<universe>::size == universe::size,
+            "Types in the universe must be unique");
+
+    static constexpr ::std::size_t word_bits   = 64;
+    static constexpr ::std::size_t size        = universe::size;
+    static constexpr ::std::size_t word_count  =
+            size == 0 ? 1 : (size + word_bits - 1) / word_bits;
+
+    template < typename U >
+    static constexpr ::std::size_t index_of = meta::dense_type_id_v<U, universe>;
+public:
+    constexpr type_bitset() noexcept : words_{} {}
+    template < typename ... U >
+    constexpr explicit
+    type_bitset(meta::type_tuple<U...> const&) noexcept
+        : words_{}
+    {
+        ::std::size_t const indexes[]{ index_of<U>..., size };
+        for (::std::size_t i = 0; i < sizeof ... (U); ++i)
+            set(indexes[i]);
+    }
+
+    /**
+     * Make a set of the types
+     */
+    template < typename ... U >
+    static constexpr type_bitset
+    of() noexcept
+    { return type_bitset{ meta::type_tuple<U...>{} }; }
+
+    template < typename U >
+    constexpr type_bitset&
+    insert() noexcept
+    { return set(index_of<U>); }
+    template < typename U >
+    constexpr type_bitset&
+    erase() noexcept
+    { return reset(index_of<U>); }
+    template < typename U >
+    constexpr bool
+    has() const noexcept
+    { return test(index_of<U>); }
+
+    //@{
+    /** @name Access by dense type index */
+    constexpr type_bitset&
+    set(::std::size_t index) noexcept
+    {
+        words_[index / word_bits] |= bit(index);
+        return *this;
+    }
+    constexpr type_bitset&
+    reset(::std::size_t index) noexcept
+    {
+        words_[index / word_bits] &= ~bit(index);
+        return *this;
+    }
+    constexpr bool
+    test(::std::size_t index) const noexcept
+    { return (words_[index / word_bits] & bit(index)) != 0; }
+    //@}
+
+    /**
+     * Check that the set contains all of Required and none of Excluded
+     * types. Compiles to a mask-and-compare per word.
+     */
+    template < typename Required, typename Excluded = meta::type_tuple<> >
+    constexpr bool
+    matches() const noexcept
+    {
+        constexpr type_bitset required{ Required{} };
+        constexpr type_bitset excluded{ Excluded{} };
+        constexpr type_bitset mask = required | excluded;
+        bool res = true;
+        for (::std::size_t i = 0; i < word_count; ++i)
+            res &= (words_[i] & mask.words_[i]) == required.words_[i];
+        return res;
+    }
+
+    /**
+     * All types of the other set are in this set
+     */
+    constexpr bool
+    contains(type_bitset const& rhs) const noexcept
+    {
+        bool res = true;
+        for (::std::size_t i = 0; i < word_count; ++i)
+            res &= (words_[i] & rhs.words_[i]) == rhs.words_[i];
+        return res;
+    }
+    constexpr bool
+    is_subset_of(type_bitset const& rhs) const noexcept
+    { return rhs.contains(*this); }
+    constexpr bool
+    intersects(type_bitset const& rhs) const noexcept
+    {
+        word_type res = 0;
+        for (::std::size_t i = 0; i < word_count; ++i)
+            res |= words_[i] & rhs.words_[i];
+        return res != 0;
+    }
+
+    constexpr ::std::size_t
+    count() const noexcept
+    {
+        ::std::size_t res = 0;
+        for (::std::size_t i = 0; i < word_count; ++i)
+            res += detail::popcount(words_[i]);
+        return res;
+    }
+    constexpr bool
+    empty() const noexcept
+    {
+        word_type res = 0;
+        for (::std::size_t i = 0; i < word_count; ++i)
+            res |= words_[i];
+        return res == 0;
+    }
+    constexpr void
+    clear() noexcept
+    {
+        for (::std::size_t i = 0; i < word_count; ++i)
+            words_[i] = 0;
+    }
+
+    constexpr type_bitset&
+    operator |= (type_bitset const& rhs) noexcept
+    {
+        for (::std::size_t i = 0; i < word_count; ++i)
+            words_[i] |= rhs.words_[i];
+        return *this;
+    }
+    constexpr type_bitset&
+    operator &= (type_bitset const& rhs) noexcept
+    {
+        for (::std::size_t i = 0; i < word_count; ++i)
+            words_[i] &= rhs.words_[i];
+        return *this;
+    }
+    constexpr type_bitset&
+    operator -= (type_bitset const& rhs) noexcept
+    {
+        for (::std::size_t i = 0; i < word_count; ++i)
+            words_[i] &= ~rhs.words_[i];
+        return *this;
+    }
+
+    friend constexpr type_bitset
+    operator | (type_bitset lhs, type_bitset const& rhs) noexcept
+    { return lhs |= rhs; }
+    friend constexpr type_bitset
+    operator & (type_bitset lhs, type_bitset const& rhs) noexcept
+    { return lhs &= rhs; }
+    friend constexpr type_bitset
+    operator - (type_bitset lhs, type_bitset const& rhs) noexcept
+    { return lhs -= rhs; }
+
+    friend constexpr bool
+    operator == (type_bitset const& lhs, type_bitset const& rhs) noexcept
+    {
+        bool res = true;
+        for (::std::size_t i = 0; i < word_count; ++i)
+            res &= lhs.words_[i] == rhs.words_[i];
+        return res;
+    }
+    friend constexpr bool
+    operator != (type_bitset const& lhs, type_bitset const& rhs) noexcept
+    { return !(lhs == rhs); }
+
+    constexpr word_type
+    word(::std::size_t n) const noexcept
+    { return words_[n]; }
+private:
+    static constexpr word_type
+    bit(::std::size_t index) noexcept
+    { return word_type{1} << (index % word_bits); }
+
+    word_type words_[word_count];
+};
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_TYPE_BITSET_HPP_ */
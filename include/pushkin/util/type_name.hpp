@@ -0,0 +1,198 @@
+/*
+ * type_name.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_TYPE_NAME_HPP_
+#define PUSHKIN_UTIL_TYPE_NAME_HPP_
+
+#if __cplusplus >= 201703L
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace psst {
+namespace util {
+
+namespace detail {
+
+template < typename T >
+constexpr ::std::string_view
+pretty_function_name() noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+/**
+ * Position of the type name in the pretty function name is found by
+ * probing with a known type.
+ */
+constexpr ::std::string_view probe_type_name        = "double";
+constexpr ::std::size_t type_name_prefix            =
+        pretty_function_name<double>().find(probe_type_name);
+constexpr ::std::size_t type_name_suffix            =
+        pretty_function_name<double>().size() - type_name_prefix - probe_type_name.size();
+
+template < typename T >
+constexpr ::std::string_view
+raw_type_name() noexcept
+{
+    auto name = pretty_function_name<T>();
+    return name.substr(type_name_prefix,
+            name.size() - type_name_prefix - type_name_suffix);
+}
+
+constexpr bool
+is_identifier_char(char c) noexcept
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')
+            || (c >= '0' && c <= '9') || c == '_';
+}
+
+struct name_replacement {
+    ::std::string_view  from;
+    ::std::string_view  to;
+};
+
+/**
+ * Normalize a compiler specific type name to a common format:
+ *   - `class`, `struct`, `union` and `enum` keywords are dropped;
+ *   - integer types are spelled `long`, `unsigned short` etc, without `int`;
+ *   - anonymous namespaces are spelled `(anonymous namespace)`;
+ *   - no whitespace between closing angle brackets and before `*` or `&`;
+ *   - a comma is followed by a single space.
+ * If out is nullptr only counts the size of the result.
+ * @return Size of the normalized name
+ */
+constexpr ::std::size_t
+normalize_type_name(::std::string_view in, char* out) noexcept
+{
+    // Replaced only if found at word boundaries
+    constexpr name_replacement words[] {
+        { "class ",                 "" },
+        { "struct ",                "" },
+        { "union ",                 "" },
+        { "enum ",                  "" },
+        { "long long unsigned int", "unsigned long long" },
+        { "long long int",          "long long" },
+        { "long unsigned int",      "unsigned long" },
+        { "long int",               "long" },
+        { "short unsigned int",     "unsigned short" },
+        { "short int",              "short" },
+    };
+    constexpr name_replacement anonymous[] {
+        { "{anonymous}",            "(anonymous namespace)" },
+        { "`anonymous namespace'",  "(anonymous namespace)" },
+    };
+
+    ::std::size_t sz = 0;
+    auto put = [&](::std::string_view str) {
+        for (auto c : str) {
+            if (out)
+                out[sz] = c;
+            ++sz;
+        }
+    };
+    auto replace = [&](::std::size_t& pos, name_replacement const& r, bool word) {
+        auto rest = in.substr(pos);
+        if (rest.substr(0, r.from.size()) != r.from)
+            return false;
+        if (word) {
+            if (pos > 0 && is_identifier_char(in[pos - 1]))
+                return false;
+            if (r.from.back() != ' ' && rest.size() > r.from.size()
+                    && is_identifier_char(rest[r.from.size()]))
+                return false;
+        }
+        put(r.to);
+        pos += r.from.size();
+        return true;
+    };
+
+    for (::std::size_t pos = 0; pos < in.size();) {
+        bool replaced = false;
+        for (auto const& r : words) {
+            if ((replaced = replace(pos, r, true)))
+                break;
+        }
+        for (auto const& r : anonymous) {
+            if (replaced || (replaced = replace(pos, r, false)))
+                break;
+        }
+        if (replaced)
+            continue;
+
+        auto c = in[pos];
+        if (c == ' ' && pos + 1 < in.size()
+                && (in[pos + 1] == '*' || in[pos + 1] == '&'
+                    || (in[pos + 1] == '>' && pos > 0 && in[pos - 1] == '>'))) {
+            ++pos;
+            continue;
+        }
+        put(in.substr(pos, 1));
+        ++pos;
+        if (c == ',') {
+            put(" ");
+            while (pos < in.size() && in[pos] == ' ')
+                ++pos;
+        }
+    }
+    return sz;
+}
+
+template < ::std::size_t Size >
+constexpr ::std::array<char, Size + 1>
+normalized_type_name(::std::string_view raw) noexcept
+{
+    ::std::array<char, Size + 1> res{};
+    normalize_type_name(raw, res.data());
+    return res;
+}
+
+template < typename T >
+struct type_name_storage {
+    static constexpr ::std::string_view raw    = raw_type_name<T>();
+    static constexpr ::std::size_t size        = normalize_type_name(raw, nullptr);
+    static constexpr ::std::array<char, size + 1> value
+            = normalized_type_name<size>(raw);
+};
+
+}  /* namespace detail */
+
+/**
+ * Compile-time type name, doesn't need RTTI and never allocates.
+ * The name is extracted from the compiler's pretty function name and
+ * normalized, so that GCC and Clang produce the same names for the
+ * same types, e.g. `std::vector<std::vector<int>>`, `const char*`.
+ *
+ * The returned view is null-terminated.
+ *
+ * Usage:
+ * @code
+ * static_assert(type_name<int>() == "int");
+ * @endcode
+ */
+template < typename T >
+constexpr ::std::string_view
+type_name() noexcept
+{
+    using storage = detail::type_name_storage<T>;
+    return ::std::string_view{ storage::value.data(), storage::size };
+}
+
+template < typename T >
+constexpr ::std::string_view type_name_v = type_name<T>();
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* __cplusplus >= 201703L */
+
+#endif /* PUSHKIN_UTIL_TYPE_NAME_HPP_ */
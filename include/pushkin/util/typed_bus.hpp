@@ -0,0 +1,173 @@
+/*
+ * typed_bus.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_TYPED_BUS_HPP_
+#define PUSHKIN_UTIL_TYPED_BUS_HPP_
+
+#include <pushkin/meta/type_id.hpp>
+#include <pushkin/util/ring_buffer.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace psst {
+namespace util {
+
+/**
+ * Capacity of a message queue in a typed_bus, must be a power of two.
+ * Specialize for a message type to change it's queue capacity.
+ */
+template < typename Message >
+struct bus_queue_capacity : ::std::integral_constant<::std::size_t, 1024> {};
+
+/**
+ * Queue policy for a bus with a single producer thread
+ */
+struct single_producer {
+    template < typename T, ::std::size_t Capacity >
+    using queue_type = spsc_ring_buffer<T, Capacity>;
+};
+
+/**
+ * Queue policy for a bus with many producer threads
+ */
+struct multi_producer {
+    template < typename T, ::std::size_t Capacity >
+    using queue_type = mpsc_ring_buffer<T, Capacity>;
+};
+
+template < typename Messages, typename ProducerPolicy = single_producer,
+        template < typename > class Capacity = bus_queue_capacity >
+class typed_bus;
+
+/**
+ * Message bus with a separate lock-free ring buffer for each message type.
+ * Messages are stored in the queues in place, without boxing or type
+ * erasure, and handlers are selected at compile time.
+ *
+ * There is a single consumer, the number of producers depends on the
+ * ProducerPolicy.
+ *
+ * Usage:
+ * @code
+ * using bus_type = typed_bus< type_tuple<order, cancel, heartbeat>, multi_producer >;
+ * bus_type bus;
+ * // Producer thread
+ * bus.post<order>(id, price, qty);
+ * // Consumer thread
+ * bus.drain([&](auto& msg) { handle(msg); });
+ * @endcode
+ */
+template < typename ... Messages, typename ProducerPolicy,
+        template < typename > class Capacity >
+class typed_bus< meta::type_tuple<Messages...>, ProducerPolicy, Capacity > {
+public:
+    using message_types = meta::type_tuple<Messages...>;
+    static_assert(message_types::size > 0, "Bus must have at least one message type");
+    static_assert(meta::unique_t<message_types>::size == message_types::size,
+            "Message types must be unique");
+
+    template < typename T >
+    using queue_type = typename ProducerPolicy::template queue_type<
+            T, Capacity<T>::value>;
+    static constexpr ::std::size_t npos = ::std::numeric_limits<::std::size_t>::max();
+public:
+    typed_bus() : queues_{} {}
+    typed_bus(typed_bus const&) = delete;
+    typed_bus&
+    operator = (typed_bus const&) = delete;
+
+    /**
+     * Construct a message in the queue for it's type.
+     * @return false if the queue is full
+     */
+    template < typename T, typename ... Args >
+    bool
+    try_post(Args&& ... args)
+    {
+        return queue<T>().try_emplace(::std::forward<Args>(args)...);
+    }
+    /**
+     * Construct a message in the queue for it's type, yield while the
+     * queue is full.
+     */
+    template < typename T, typename ... Args >
+    void
+    post(Args&& ... args)
+    {
+        auto& q = queue<T>();
+        // Arguments are not consumed unless the message is constructed
+        while (!q.try_emplace(::std::forward<Args>(args)...))
+            ::std::this_thread::yield();
+    }
+
+    /**
+     * Call the handler for up to max messages of each type, queues are
+     * drained in the order of the message types.
+     * The handler must be callable with an lvalue reference to every
+     * message type, e.g. a generic lambda or an overload set.
+     * @return Number of messages handled
+     */
+    template < typename Handler >
+    ::std::size_t
+    drain(Handler&& handler, ::std::size_t max = npos)
+    {
+        ::std::size_t count = 0;
+        (void)::std::initializer_list<int>{
+            (count += queue<Messages>().consume(handler, max), 0)... };
+        return count;
+    }
+    /**
+     * Call the handler for up to max messages of a single type
+     * @return Number of messages handled
+     */
+    template < typename T, typename Handler >
+    ::std::size_t
+    drain(Handler&& handler, ::std::size_t max = npos)
+    {
+        return queue<T>().consume(handler, max);
+    }
+
+    template < typename T >
+    queue_type<T>&
+    queue()
+    {
+        return ::std::get< meta::dense_type_id_v<T, message_types> >(queues_);
+    }
+    template < typename T >
+    queue_type<T> const&
+    queue() const
+    {
+        return ::std::get< meta::dense_type_id_v<T, message_types> >(queues_);
+    }
+
+    /**
+     * Approximate number of messages in all queues
+     */
+    ::std::size_t
+    size() const noexcept
+    {
+        ::std::size_t count = 0;
+        (void)::std::initializer_list<int>{ (count += queue<Messages>().size(), 0)... };
+        return count;
+    }
+    bool
+    empty() const noexcept
+    { return size() == 0; }
+private:
+    ::std::tuple< queue_type<Messages>... > queues_;
+};
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_TYPED_BUS_HPP_ */
@@ -0,0 +1,517 @@
+/*
+ * typed_pool.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#ifndef PUSHKIN_UTIL_TYPED_POOL_HPP_
+#define PUSHKIN_UTIL_TYPED_POOL_HPP_
+
+#include <pushkin/meta/type_id.hpp>
+#include <pushkin/util/construct.hpp>
+#include <pushkin/util/ring_buffer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace psst {
+namespace util {
+
+/**
+ * Typed handle to an object allocated in a typed_pool.
+ * Doesn't own the object.
+ */
+template < typename T >
+class pool_handle {
+public:
+    using element_type = T;
+public:
+    pool_handle() noexcept : ptr_{nullptr} {}
+    explicit
+    pool_handle(T* ptr) noexcept : ptr_{ptr} {}
+
+    T*
+    get() const noexcept
+    { return ptr_; }
+    T&
+    operator *() const noexcept
+    { return *ptr_; }
+    T*
+    operator ->() const noexcept
+    { return ptr_; }
+    explicit
+    operator bool() const noexcept
+    { return ptr_ != nullptr; }
+
+    friend bool
+    operator == (pool_handle const& lhs, pool_handle const& rhs) noexcept
+    { return lhs.ptr_ == rhs.ptr_; }
+    friend bool
+    operator != (pool_handle const& lhs, pool_handle const& rhs) noexcept
+    { return lhs.ptr_ != rhs.ptr_; }
+private:
+    T* ptr_;
+};
+
+namespace detail {
+
+/**
+ * Size of a pool slot for a type. Slots are aligned to the strictest
+ * fundamental alignment and can hold a freelist pointer.
+ */
+template < typename T >
+constexpr ::std::size_t
+pool_slot_size() noexcept
+{
+    constexpr ::std::size_t align = alignof(::std::max_align_t);
+    constexpr ::std::size_t size = sizeof(T) > sizeof(void*) ? sizeof(T) : sizeof(void*);
+    return (size + align - 1) / align * align;
+}
+
+/**
+ * Size classes of a pool, distinct slot sizes in ascending order.
+ */
+template < ::std::size_t ... Sizes >
+struct pool_size_classes {
+    /**
+     * Number of distinct sizes
+     */
+    static constexpr ::std::size_t
+    count() noexcept
+    {
+        ::std::size_t const sizes[]{ Sizes... };
+        ::std::size_t res = 0;
+        for (::std::size_t i = 0; i < sizeof ... (Sizes); ++i)
+            res += is_first(sizes, i);
+        return res;
+    }
+    /**
+     * Index of the size in the sorted list of distinct sizes
+     */
+    static constexpr ::std::size_t
+    class_of(::std::size_t size) noexcept
+    {
+        ::std::size_t const sizes[]{ Sizes... };
+        ::std::size_t res = 0;
+        for (::std::size_t i = 0; i < sizeof ... (Sizes); ++i)
+            res += sizes[i] < size && is_first(sizes, i);
+        return res;
+    }
+    static constexpr ::std::size_t
+    class_size(::std::size_t cls) noexcept
+    {
+        ::std::size_t const sizes[]{ Sizes... };
+        for (::std::size_t i = 0; i < sizeof ... (Sizes); ++i) {
+            if (class_of(sizes[i]) == cls)
+                return sizes[i];
+        }
+        return 0;
+    }
+private:
+    static constexpr bool
+    is_first(::std::size_t const* sizes, ::std::size_t n) noexcept
+    {
+        for (::std::size_t i = 0; i < n; ++i) {
+            if (sizes[i] == sizes[n])
+                return false;
+        }
+        return true;
+    }
+};
+
+class pool_cache_base {
+public:
+    virtual ~pool_cache_base() {}
+};
+
+class typed_pool_base {
+public:
+    virtual ~typed_pool_base() {}
+    /**
+     * Return cached slots and counters of an exiting thread to the pool
+     */
+    virtual void
+    detach(pool_cache_base* cache) = 0;
+};
+
+/**
+ * Registry of live pools. Pool ids are never reused, so a thread cache
+ * can outlive it's pool.
+ */
+struct pool_registry {
+    pool_registry() : mutex{}, pools{}, next_id{1} {}
+
+    ::std::mutex                                            mutex;
+    ::std::unordered_map<::std::uint64_t, typed_pool_base*> pools;
+    ::std::uint64_t                                         next_id;
+
+    static pool_registry&
+    instance()
+    {
+        static pool_registry registry;
+        return registry;
+    }
+};
+
+/**
+ * Pool caches of a thread
+ */
+class thread_pool_caches {
+public:
+    thread_pool_caches() : caches_{} {}
+    thread_pool_caches(thread_pool_caches const&) = delete;
+    thread_pool_caches&
+    operator = (thread_pool_caches const&) = delete;
+    ~thread_pool_caches()
+    {
+        auto& registry = pool_registry::instance();
+        ::std::lock_guard<::std::mutex> lock{registry.mutex};
+        for (auto& cache : caches_) {
+            auto pool = registry.pools.find(cache.first);
+            if (pool != registry.pools.end())
+                pool->second->detach(cache.second.get());
+        }
+    }
+
+    pool_cache_base*
+    find(::std::uint64_t pool_id) const noexcept
+    {
+        for (auto const& cache : caches_) {
+            if (cache.first == pool_id)
+                return cache.second.get();
+        }
+        return nullptr;
+    }
+    /**
+     * Add a cache for a pool, caches of destroyed pools are removed
+     */
+    void
+    add(::std::uint64_t pool_id, ::std::unique_ptr<pool_cache_base> cache)
+    {
+        {
+            auto& registry = pool_registry::instance();
+            ::std::lock_guard<::std::mutex> lock{registry.mutex};
+            caches_.erase(::std::remove_if(caches_.begin(), caches_.end(),
+                [&](cache_entry const& e) { return registry.pools.count(e.first) == 0; }),
+                caches_.end());
+        }
+        caches_.emplace_back(pool_id, ::std::move(cache));
+    }
+
+    static thread_pool_caches&
+    instance()
+    {
+        static thread_local thread_pool_caches caches;
+        return caches;
+    }
+private:
+    using cache_entry = ::std::pair< ::std::uint64_t, ::std::unique_ptr<pool_cache_base> >;
+    ::std::vector<cache_entry> caches_;
+};
+
+struct pool_cache_ref {
+    ::std::uint64_t     pool_id;
+    pool_cache_base*    cache;
+};
+
+}  /* namespace detail */
+
+template < typename Types, ::std::size_t CacheSize = 64,
+        ::std::size_t SlabSize = 64 * 1024 >
+class typed_pool;
+
+/**
+ * Pool allocator for a known set of object types.
+ *
+ * Types are grouped into size classes by their slot size, size classes
+ * are computed at compile time. Each size class has a central freelist of
+ * slots carved from slabs of about SlabSize bytes, and each thread has a
+ * cache of up to CacheSize free slots per size class, so most allocations
+ * and deallocations don't take a lock. The freelist for a type is
+ * resolved at compile time.
+ *
+ * Objects can be deallocated by any thread. Memory is returned to the
+ * system only when the pool is destroyed, all objects must be deallocated
+ * by then.
+ *
+ * Usage:
+ * @code
+ * using node_pool = typed_pool< type_tuple<leaf, branch, root> >;
+ * node_pool pool;
+ * auto node = pool.allocate<leaf>(key, value);
+ * pool.deallocate(node);
+ * @endcode
+ */
+template < typename ... T, ::std::size_t CacheSize, ::std::size_t SlabSize >
+class typed_pool< meta::type_tuple<T...>, CacheSize, SlabSize >
+        : private detail::typed_pool_base {
+    using size_classes  = detail::pool_size_classes< detail::pool_slot_size<T>()... >;
+public:
+    using types         = meta::type_tuple<T...>;
+    static_assert(types::size > 0, "Pool must have at least one type");
+    static_assert(meta::unique_t<types>::size == types::size, "Pool types must be unique");
+    static_assert(CacheSize >= 2, "Thread cache size must be at least 2");
+    static_assert(meta::max_of_v< ::std::size_t, alignof(T)... >
+                <= alignof(::std::max_align_t), "Over-aligned types are not supported");
+
+    static constexpr ::std::size_t type_count   = types::size;
+    static constexpr ::std::size_t class_count  = size_classes::count();
+
+    template < typename U >
+    static constexpr ::std::size_t type_index_of = meta::dense_type_id_v<U, types>;
+    template < typename U >
+    static constexpr ::std::size_t class_of =
+            size_classes::class_of(detail::pool_slot_size<U>());
+
+    /**
+     * Pool occupancy
+     */
+    struct stats_type {
+        /** Number of live objects per type */
+        ::std::array< ::std::size_t, type_count >   live;
+        /** Slot size per size class */
+        ::std::array< ::std::size_t, class_count >  slot_size;
+        /** Number of slots allocated from the system per size class */
+        ::std::array< ::std::size_t, class_count >  reserved;
+
+        template < typename U >
+        ::std::size_t
+        live_of() const noexcept
+        { return live[type_index_of<U>]; }
+    };
+public:
+    typed_pool()
+        : central_{}, stats_mutex_{}, caches_{}, retired_live_{}, id_{0}
+    {
+        auto& registry = detail::pool_registry::instance();
+        ::std::lock_guard<::std::mutex> lock{registry.mutex};
+        id_ = registry.next_id++;
+        registry.pools.emplace(id_, static_cast<detail::typed_pool_base*>(this));
+    }
+    typed_pool(typed_pool const&) = delete;
+    typed_pool&
+    operator = (typed_pool const&) = delete;
+    ~typed_pool()
+    {
+        auto& registry = detail::pool_registry::instance();
+        ::std::lock_guard<::std::mutex> lock{registry.mutex};
+        registry.pools.erase(id_);
+    }
+
+    /**
+     * Allocate and construct an object
+     */
+    template < typename U, typename ... Args >
+    pool_handle<U>
+    allocate(Args&& ... args)
+    {
+        constexpr auto cls = class_of<U>;
+        auto& cache = local_cache();
+        void* slot = cache.pop(cls);
+        if (!slot) {
+            refill(cache, cls);
+            slot = cache.pop(cls);
+        }
+        U* obj = nullptr;
+        try {
+            obj = construct_in_place<U>(slot, ::std::forward<Args>(args)...);
+        } catch (...) {
+            cache.push(cls, slot);
+            throw;
+        }
+        cache.add_live(type_index_of<U>, 1);
+        return pool_handle<U>{ obj };
+    }
+    /**
+     * Destroy and deallocate an object. The first call in a thread creates
+     * the thread's cache and can throw std::bad_alloc, returning slots of a
+     * full cache locks the shared list and can throw std::system_error.
+     * The object is not destroyed in both cases.
+     */
+    template < typename U >
+    void
+    deallocate(pool_handle<U> handle)
+    {
+        constexpr auto cls = class_of<U>;
+        if (!handle)
+            return;
+        auto& cache = local_cache();
+        if (cache.full(cls))
+            flush(cache, cls, CacheSize / 2);
+        handle->~U();
+        cache.push(cls, handle.get());
+        cache.add_live(type_index_of<U>, -1);
+    }
+
+    stats_type
+    stats() const
+    {
+        stats_type res{};
+        {
+            ::std::lock_guard<::std::mutex> lock{stats_mutex_};
+            for (::std::size_t t = 0; t < type_count; ++t) {
+                auto live = retired_live_[t];
+                for (auto cache : caches_)
+                    live += cache->live[t].load(::std::memory_order_relaxed);
+                res.live[t] = static_cast<::std::size_t>(live);
+            }
+        }
+        for (::std::size_t c = 0; c < class_count; ++c) {
+            ::std::lock_guard<::std::mutex> lock{central_[c].mutex};
+            res.slot_size[c] = slot_sizes()[c];
+            res.reserved[c] = central_[c].reserved;
+        }
+        return res;
+    }
+private:
+    static ::std::size_t const*
+    slot_sizes() noexcept
+    {
+        return slot_sizes(::std::make_index_sequence<class_count>{});
+    }
+    template < ::std::size_t ... C >
+    static ::std::size_t const*
+    slot_sizes(::std::index_sequence<C...> const&) noexcept
+    {
+        static constexpr ::std::size_t sizes[]{ size_classes::class_size(C)... };
+        return sizes;
+    }
+
+    struct cache : detail::pool_cache_base {
+        cache() : items{}, counts{}, live{} {}
+        cache(cache const&) = delete;
+        cache&
+        operator = (cache const&) = delete;
+
+        void*
+        pop(::std::size_t cls) noexcept
+        { return counts[cls] ? items[cls][--counts[cls]] : nullptr; }
+        void
+        push(::std::size_t cls, void* slot) noexcept
+        { items[cls][counts[cls]++] = slot; }
+        bool
+        full(::std::size_t cls) const noexcept
+        { return counts[cls] == CacheSize; }
+        void
+        add_live(::std::size_t type, ::std::ptrdiff_t n) noexcept
+        {
+            // Written only by the owning thread
+            live[type].store(live[type].load(::std::memory_order_relaxed) + n,
+                    ::std::memory_order_relaxed);
+        }
+
+        void*                           items[class_count][CacheSize];
+        ::std::size_t                   counts[class_count];
+        ::std::atomic<::std::ptrdiff_t> live[type_count];
+    };
+
+    struct alignas(cache_line_size) central_list {
+        central_list() : mutex{}, head{nullptr}, slabs{}, reserved{0} {}
+        central_list(central_list const&) = delete;
+        central_list&
+        operator = (central_list const&) = delete;
+
+        ::std::mutex                                        mutex;
+        void*                                               head;
+        ::std::vector< ::std::unique_ptr<unsigned char[]> > slabs;
+        ::std::size_t                                       reserved;
+    };
+
+    static void*&
+    next_of(void* slot) noexcept
+    { return *static_cast<void**>(slot); }
+
+    cache&
+    local_cache()
+    {
+        static thread_local detail::pool_cache_ref last{ 0, nullptr };
+        if (last.pool_id != id_) {
+            auto& caches = detail::thread_pool_caches::instance();
+            auto* found = caches.find(id_);
+            if (!found) {
+                ::std::unique_ptr<cache> created{ new cache{} };
+                {
+                    ::std::lock_guard<::std::mutex> lock{stats_mutex_};
+                    caches_.push_back(created.get());
+                }
+                found = created.get();
+                caches.add(id_, ::std::move(created));
+            }
+            last = detail::pool_cache_ref{ id_, found };
+        }
+        return *static_cast<cache*>(last.cache);
+    }
+
+    void
+    refill(cache& c, ::std::size_t cls)
+    {
+        auto& central = central_[cls];
+        ::std::lock_guard<::std::mutex> lock{central.mutex};
+        if (!central.head)
+            add_slab(central, slot_sizes()[cls]);
+        for (::std::size_t i = 0; i < CacheSize / 2 && central.head; ++i) {
+            void* slot = central.head;
+            central.head = next_of(slot);
+            c.push(cls, slot);
+        }
+    }
+    void
+    flush(cache& c, ::std::size_t cls, ::std::size_t n)
+    {
+        auto& central = central_[cls];
+        ::std::lock_guard<::std::mutex> lock{central.mutex};
+        for (void* slot = nullptr; n > 0 && (slot = c.pop(cls)); --n) {
+            next_of(slot) = central.head;
+            central.head = slot;
+        }
+    }
+    static void
+    add_slab(central_list& central, ::std::size_t slot_size)
+    {
+        auto slots = SlabSize / slot_size;
+        if (slots == 0)
+            slots = 1;
+        central.slabs.emplace_back(new unsigned char[slots * slot_size]);
+        auto* slab = central.slabs.back().get();
+        for (::std::size_t i = slots; i > 0; --i) {
+            void* slot = slab + (i - 1) * slot_size;
+            next_of(slot) = central.head;
+            central.head = slot;
+        }
+        central.reserved += slots;
+    }
+
+    void
+    detach(detail::pool_cache_base* base) override
+    {
+        auto* c = static_cast<cache*>(base);
+        for (::std::size_t cls = 0; cls < class_count; ++cls)
+            flush(*c, cls, CacheSize);
+        ::std::lock_guard<::std::mutex> lock{stats_mutex_};
+        for (::std::size_t t = 0; t < type_count; ++t)
+            retired_live_[t] += c->live[t].load(::std::memory_order_relaxed);
+        caches_.erase(::std::remove(caches_.begin(), caches_.end(), c), caches_.end());
+    }
+
+    mutable ::std::array<central_list, class_count> central_;
+    mutable ::std::mutex                            stats_mutex_;
+    ::std::vector<cache*>                           caches_;
+    ::std::ptrdiff_t                                retired_live_[type_count];
+    ::std::uint64_t                                 id_;
+};
+
+}  /* namespace util */
+}  /* namespace psst */
+
+#endif /* PUSHKIN_UTIL_TYPED_POOL_HPP_ */
@@ -0,0 +1,445 @@
+/*
+ * callable_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#include <gtest/gtest.h>
+#include <pushkin/meta/callable.hpp>
+#include <pushkin/meta/function_traits.hpp>
+#include <pushkin/util/fuse.hpp>
+#include <pushkin/util/inplace_function.hpp>
+
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+namespace psst {
+namespace meta {
+namespace test {
+
+struct is_even {
+    bool
+    operator()(int v) const
+    { return v % 2 == 0; }
+};
+
+struct is_positive {
+    bool
+    operator()(int v) const
+    { return v > 0; }
+};
+
+struct is_small {
+    bool
+    operator()(int v) const
+    { return v < 10; }
+};
+
+TEST(Predicates, OrChain)
+{
+    using pred = or_<is_even, is_positive, is_small>;
+    // Neither even nor positive, but small
+    EXPECT_TRUE(pred{}(-3));
+    EXPECT_TRUE(pred::fused(-3));
+    EXPECT_FALSE((or_<is_even, is_positive, not_<is_small>>{}(-3)));
+    EXPECT_FALSE((or_<is_even, is_positive, not_<is_small>>::fused(-3)));
+}
+
+TEST(Predicates, BatchEvaluate)
+{
+    using pred = and_<is_even, or_<is_positive, not_<is_small>>>;
+    ::std::vector<int> data;
+    for (int i = -100; i < 100; ++i)
+        data.push_back(i);
+
+    ::std::vector<::std::uint64_t> mask(pred::mask_size(data.size()));
+    pred::evaluate(data.data(), data.size(), mask.data());
+
+    ::std::vector<::std::size_t> indexes(data.size());
+    auto count = pred::select(data.data(), data.size(), indexes.data());
+
+    ::std::size_t expected_count = 0;
+    for (::std::size_t i = 0; i < data.size(); ++i) {
+        bool expected = pred{}(data[i]);
+        EXPECT_EQ(expected, static_cast<bool>((mask[i / 64] >> (i % 64)) & 1))
+            << "Value " << data[i];
+        if (expected) {
+            ASSERT_LT(expected_count, count);
+            EXPECT_EQ(i, indexes[expected_count]);
+            ++expected_count;
+        }
+    }
+    EXPECT_EQ(expected_count, count);
+    // Unused bits of the last word are cleared
+    EXPECT_EQ(0u, mask.back() >> (data.size() % 64));
+}
+
+#if __cplusplus >= 202002L
+TEST(Predicates, BatchRange)
+{
+    using pred = and_<is_even, is_positive>;
+    ::std::vector<int> data{ -2, 1, 2, 3, 4 };
+    ::std::vector<::std::uint64_t> mask(pred::mask_size(data.size()));
+    pred::evaluate(data, mask.data());
+    EXPECT_EQ(0b10100u, mask[0]);
+    pred::evaluate(::std::span<int>{ data }, mask.data());
+    EXPECT_EQ(0b10100u, mask[0]);
+    pred::evaluate(::std::span<int const>{ data }, mask.data());
+    EXPECT_EQ(0b10100u, mask[0]);
+
+    ::std::vector<::std::size_t> indexes(data.size());
+    EXPECT_EQ(2ul, pred::select(::std::span<int>{ data }, indexes.data()));
+    EXPECT_EQ(2ul, indexes[0]);
+    EXPECT_EQ(4ul, indexes[1]);
+    EXPECT_EQ(2ul, pred::select(data, indexes.data()));
+}
+#endif
+
+struct square {
+    long
+    operator()(int v) const
+    { return static_cast<long>(v) * v; }
+};
+
+struct is_odd_long {
+    bool
+    operator()(long v) const
+    { return v % 2 != 0; }
+};
+
+struct plus_long {
+    long
+    operator()(long acc, long v) const
+    { return acc + v; }
+};
+
+struct max_long {
+    long
+    operator()(long acc, long v) const
+    { return acc > v ? acc : v; }
+};
+
+TEST(Fuse, MapFilter)
+{
+    ::std::vector<int> data;
+    for (int i = -100; i < 100; ++i)
+        data.push_back(i);
+    ::std::vector<long> out(data.size());
+    auto count = util::fuse< util::filter_< and_<is_even, is_positive> >,
+            util::map_<square> >(data.data(), data.size(), out.data());
+
+    ::std::vector<long> expected;
+    for (auto v : data)
+        if (v % 2 == 0 && v > 0)
+            expected.push_back(square{}(v));
+    out.resize(count);
+    EXPECT_EQ(expected, out);
+}
+
+TEST(Fuse, Reduce)
+{
+    ::std::vector<int> data{ 1, 2, 3, 4, 5 };
+    auto sum = util::fuse< util::map_<square>, util::filter_<is_odd_long>,
+            util::reduce_<plus_long> >(data.data(), data.size(), 0);
+    static_assert(::std::is_same<decltype(sum), long>::value, "");
+    EXPECT_EQ(1 + 9 + 25, sum);
+    EXPECT_EQ(25, (util::fuse< util::map_<square>, util::reduce_<max_long> >(
+            data.data(), data.size(), 0)));
+}
+
+struct not_null {
+    bool
+    operator()(int const* p) const
+    { return p != nullptr; }
+};
+
+struct deref {
+    int
+    operator()(int const* p) const
+    { return *p; }
+};
+
+struct throw_negative {
+    int
+    operator()(int v) const
+    {
+        if (v < 0)
+            throw ::std::domain_error{"negative"};
+        return v;
+    }
+};
+
+TEST(Fuse, FilterGuardsNextOperations)
+{
+    int values[]{ 1, 2, 3 };
+    ::std::vector<int const*> data{ &values[0], nullptr, &values[1], nullptr, &values[2] };
+    ::std::vector<long> out(data.size());
+    auto count = util::fuse< util::filter_<not_null>, util::map_<deref> >(
+            data.data(), data.size(), out.data());
+    out.resize(count);
+    EXPECT_EQ((::std::vector<long>{ 1, 2, 3 }), out);
+    EXPECT_EQ(6, (util::fuse< util::filter_<not_null>, util::map_<deref>,
+            util::reduce_<plus_long> >(data.data(), data.size(), 0)));
+}
+
+TEST(Fuse, ParallelException)
+{
+    ::std::vector<int> data(100000, 1);
+    data.front() = -1;
+    ::std::vector<long> out(data.size());
+    EXPECT_THROW((util::fuse_parallel< util::map_<throw_negative> >(
+            data.data(), data.size(), out.data(), 4)), ::std::domain_error);
+    data.front() = 1;
+    data.back() = -1;
+    EXPECT_THROW((util::fuse_parallel< util::map_<throw_negative>,
+            util::reduce_<plus_long> >(data.data(), data.size(), 0, 4)), ::std::domain_error);
+}
+
+#if __cplusplus >= 202002L
+TEST(Fuse, Range)
+{
+    ::std::vector<int> data{ 1, 2, 3, 4, 5 };
+    ::std::vector<long> out(data.size());
+    auto count = util::fuse< util::map_<square>, util::filter_<is_odd_long> >(
+            ::std::span<int>{ data }, out.data());
+    out.resize(count);
+    EXPECT_EQ((::std::vector<long>{ 1, 9, 25 }), out);
+    EXPECT_EQ(55, (util::fuse< util::map_<square>, util::reduce_<plus_long> >(data, 0)));
+    EXPECT_EQ(55, (util::fuse< util::map_<square>, util::reduce_<plus_long> >(
+            ::std::span<int const>{ data }, 0)));
+}
+#endif
+
+TEST(Fuse, Parallel)
+{
+    ::std::vector<int> data;
+    for (int i = 0; i < 100000; ++i)
+        data.push_back(i % 1000 - 500);
+    using filter = util::filter_< or_<is_even, not_<is_small>> >;
+
+    ::std::vector<long> expected(data.size());
+    expected.resize(util::fuse< filter, util::map_<square> >(
+            data.data(), data.size(), expected.data()));
+    ::std::vector<long> out(data.size());
+    out.resize(util::fuse_parallel< filter, util::map_<square> >(
+            data.data(), data.size(), out.data(), 4));
+    EXPECT_EQ(expected, out);
+
+    auto sum = util::fuse< filter, util::map_<square>, util::reduce_<plus_long> >(
+            data.data(), data.size(), 0);
+    EXPECT_EQ(sum, (util::fuse_parallel< filter, util::map_<square>,
+            util::reduce_<plus_long> >(data.data(), data.size(), 0, 4)));
+}
+
+int
+twice(int v)
+{ return v * 2; }
+
+struct counter {
+    int value = 0;
+
+    int
+    add(int v)
+    { return value += v; }
+    int
+    get() const
+    { return value; }
+    int
+    peek() const& noexcept
+    { return value; }
+    int
+    take() &&
+    { return value; }
+};
+
+static_assert(sizeof(util::function_ref<void()>) == 2 * sizeof(void*), "");
+static_assert(::std::is_same<
+        util::callable_signature_t<int(counter::*)(int)>,
+        int(counter&, int) >::value, "");
+static_assert(::std::is_same<
+        util::callable_signature_t<int(counter::*)() const>,
+        int(counter const&) >::value, "");
+static_assert(::std::is_same<
+        util::callable_signature_t<decltype(&counter::peek)>,
+        int(counter const&) >::value, "");
+static_assert(::std::is_same<
+        util::callable_signature_t<decltype(&counter::take)>,
+        int(counter&&) >::value, "");
+static_assert(::std::is_same<
+        util::callable_signature_t<int(counter::*)(int) volatile>,
+        int(counter volatile&, int) >::value, "");
+
+/**
+ * Counts copies, calls of an rvalue are distinguished
+ */
+struct counting_functor {
+    int* copies;
+
+    counting_functor(int* c) : copies{c} {}
+    counting_functor(counting_functor const& rhs) : copies{rhs.copies} { ++*copies; }
+    counting_functor(counting_functor&&) = default;
+    counting_functor&
+    operator = (counting_functor const&) = default;
+
+    int
+    operator()(int a, int b) const &
+    { return a + b; }
+    int
+    operator()(int a, int b) &&
+    { return a * b; }
+};
+
+int
+throwing_add(int a, int b)
+{ return a + b; }
+
+struct nothrow_add {
+    int
+    operator()(int a, int b) const noexcept
+    { return a + b; }
+};
+
+TEST(Invoke, ForwardsCallable)
+{
+    int copies = 0;
+    counting_functor func{&copies};
+    EXPECT_EQ(5, meta::invoke(func, 2, 3));
+    EXPECT_EQ(6, meta::invoke(::std::move(func), 2, 3));
+    auto args = ::std::make_tuple(4, 5);
+    EXPECT_EQ(9, meta::invoke(func, args));
+    EXPECT_EQ(20, meta::invoke(counting_functor{&copies}, args));
+    EXPECT_EQ(9, meta::apply(func, ::std::make_tuple(4, 5)));
+    EXPECT_EQ(0, copies);
+}
+
+TEST(Invoke, MovesTupleElements)
+{
+    auto sink = [](::std::unique_ptr<int> p) { return *p; };
+    auto args = ::std::make_tuple(::std::make_unique<int>(42));
+    EXPECT_EQ(42, meta::apply(sink, ::std::move(args)));
+    EXPECT_FALSE(::std::get<0>(args));
+}
+
+TEST(Invoke, NoexceptPropagation)
+{
+    static_assert(noexcept(meta::invoke(nothrow_add{}, 1, 2)), "");
+    static_assert(!noexcept(meta::invoke(throwing_add, 1, 2)), "");
+    auto args = ::std::make_tuple(1, 2);
+    static_assert(noexcept(meta::apply(nothrow_add{}, args)), "");
+    static_assert(!noexcept(meta::apply(throwing_add, args)), "");
+    EXPECT_EQ(3, meta::invoke(throwing_add, args));
+}
+
+TEST(FunctionRef, Call)
+{
+    int captured = 10;
+    auto lambda = [&](int v) { return v + captured; };
+    auto ref = util::make_function_ref(lambda);
+    static_assert(::std::is_same<decltype(ref), util::function_ref<int(int)>>::value, "");
+    EXPECT_EQ(11, ref(1));
+    captured = 20;
+    EXPECT_EQ(21, ref(1));
+
+    util::function_ref<long(int)> fn = &twice;
+    EXPECT_EQ(4, fn(2));
+    fn = ref;
+    EXPECT_EQ(22, fn(2));
+
+    counter c;
+    auto member = &counter::add;
+    auto add = util::make_function_ref(member);
+    EXPECT_EQ(5, add(c, 5));
+    EXPECT_EQ(5, c.value);
+
+    // Compile-time constant member function pointers need no storage
+    auto get = util::make_function_ref<decltype(&counter::get), &counter::get>();
+    static_assert(::std::is_same<decltype(get),
+            util::function_ref<int(counter const&)>>::value, "");
+    EXPECT_EQ(5, get(c));
+    auto peek = util::make_function_ref<decltype(&counter::peek), &counter::peek>();
+    EXPECT_EQ(5, peek(c));
+#if __cpp_nontype_template_parameter_auto >= 201606
+    EXPECT_EQ(10, util::make_function_ref<&counter::add>()(c, 5));
+#endif
+
+    static_assert(!::std::is_constructible<util::function_ref<int(counter&, int)>,
+            int(counter::*)(int)>::value, "Member function pointer prvalues are rejected");
+}
+
+TEST(InplaceFunction, Call)
+{
+    util::inplace_function<int(int)> empty;
+    EXPECT_FALSE(empty);
+    EXPECT_THROW(empty(1), ::std::bad_function_call);
+
+    ::std::array<int, 4> data{{1, 2, 3, 4}};
+    auto sum = util::make_inplace_function<sizeof(data)>(
+        [data](int v) {
+            for (auto d : data)
+                v += d;
+            return v;
+        });
+    EXPECT_TRUE(sum);
+    EXPECT_EQ(11, sum(1));
+
+    auto copy = sum;
+    EXPECT_EQ(12, copy(2));
+    auto moved = ::std::move(copy);
+    EXPECT_EQ(13, moved(3));
+
+    static_assert(::std::is_nothrow_move_constructible<decltype(sum)>::value, "");
+
+    util::inplace_function<int(int)> fn = &twice;
+    EXPECT_EQ(6, fn(3));
+    fn = nullptr;
+    EXPECT_FALSE(fn);
+
+    counter c;
+    auto get = util::make_inplace_function(&counter::get);
+    c.value = 42;
+    EXPECT_EQ(42, get(c));
+}
+
+TEST(InplaceFunction, Lifetime)
+{
+    auto ptr = ::std::make_shared<int>(1);
+    {
+        util::inplace_function<int()> fn = [ptr]() { return *ptr; };
+        EXPECT_EQ(2, ptr.use_count());
+        {
+            auto copy = fn;
+            EXPECT_EQ(3, ptr.use_count());
+            copy = fn;
+            EXPECT_EQ(3, ptr.use_count());
+        }
+        EXPECT_EQ(2, ptr.use_count());
+        fn = nullptr;
+        EXPECT_EQ(1, ptr.use_count());
+    }
+    EXPECT_EQ(1, ptr.use_count());
+}
+
+#if __cpp_deduction_guides >= 201606
+TEST(FunctionRef, DeductionGuides)
+{
+    auto lambda = [](int a, int b) { return a * b; };
+    util::function_ref ref = lambda;
+    static_assert(::std::is_same<decltype(ref), util::function_ref<int(int, int)>>::value);
+    util::inplace_function fn = lambda;
+    static_assert(::std::is_same<decltype(fn), util::inplace_function<int(int, int)>>::value);
+    EXPECT_EQ(6, ref(2, 3));
+    EXPECT_EQ(6, fn(2, 3));
+}
+#endif
+
+}  /* namespace test */
+}  /* namespace meta */
+}  /* namespace psst */
@@ -0,0 +1,483 @@
+/*
+ * concurrent_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#include <gtest/gtest.h>
+#include <pushkin/util/pipeline.hpp>
+#include <pushkin/util/ring_buffer.hpp>
+#include <pushkin/util/typed_bus.hpp>
+#include <pushkin/util/typed_pool.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace psst {
+namespace util {
+namespace test {
+
+namespace {
+
+struct order {
+    int     id;
+    double  price;
+};
+
+struct cancel {
+    int     id;
+};
+
+struct note {
+    ::std::string text;
+};
+
+struct big {
+    char data[100];
+};
+
+/**
+ * Counts live instances, construction from a negative value throws
+ */
+struct tracked {
+    static int live;
+
+    int value;
+
+    explicit
+    tracked(int v) : value{v}
+    {
+        if (v < 0)
+            throw ::std::invalid_argument{"negative"};
+        ++live;
+    }
+    tracked(tracked const& rhs) : value{rhs.value} { ++live; }
+    ~tracked() { --live; }
+};
+int tracked::live = 0;
+
+struct parse_stage {
+    int
+    operator()(::std::string const& str) const
+    { return ::std::stoi(str); }
+};
+
+struct square_stage {
+    long
+    operator()(int v) const
+    { return static_cast<long>(v) * v; }
+};
+
+struct sum_stage {
+    ::std::atomic<long>* sum;
+
+    void
+    operator()(long v) const
+    { sum->fetch_add(v, ::std::memory_order_relaxed); }
+};
+
+/**
+ * Takes the string it's constructed from
+ */
+struct text_record {
+    ::std::string text;
+
+    text_record(::std::string&& str) : text{ ::std::move(str) } {}
+};
+
+struct text_length_stage {
+    ::std::atomic<::std::size_t>* total;
+
+    void
+    operator()(text_record rec) const
+    { *total += rec.text.size(); }
+};
+
+struct string_stage {
+    ::std::string
+    operator()(int v) const
+    { return ::std::to_string(v); }
+};
+
+}  /* namespace  */
+
+static_assert(::std::is_same<
+        pipeline< meta::type_tuple<parse_stage, square_stage, sum_stage> >::output_type,
+        void >::value, "");
+static_assert(::std::is_same<
+        pipeline< meta::type_tuple<parse_stage, square_stage> >::output_type,
+        long >::value, "");
+
+}  /* namespace test */
+
+template <>
+struct bus_queue_capacity<test::cancel> : ::std::integral_constant<::std::size_t, 4> {};
+
+namespace test {
+
+TEST(RingBuffer, SPSC)
+{
+    spsc_ring_buffer<::std::string, 4> ring;
+    EXPECT_TRUE(ring.empty());
+    for (auto i = 0; i < 4; ++i)
+        EXPECT_TRUE(ring.try_push(::std::to_string(i)));
+    EXPECT_FALSE(ring.try_push("full"));
+    EXPECT_EQ(4ul, ring.size());
+
+    ::std::string val;
+    EXPECT_TRUE(ring.try_pop(val));
+    EXPECT_EQ("0", val);
+    EXPECT_TRUE(ring.try_emplace("4"));
+
+    ::std::vector<::std::string> consumed;
+    EXPECT_EQ(2ul, ring.consume([&](::std::string& s) { consumed.push_back(s); }, 2));
+    EXPECT_EQ((::std::vector<::std::string>{ "1", "2" }), consumed);
+    EXPECT_EQ(2ul, ring.size());
+    // The rest is destroyed by the destructor
+}
+
+TEST(RingBuffer, MPSC)
+{
+    mpsc_ring_buffer<int, 4> ring;
+    for (auto i = 0; i < 4; ++i)
+        EXPECT_TRUE(ring.try_push(i));
+    EXPECT_FALSE(ring.try_push(4));
+    int val = -1;
+    EXPECT_TRUE(ring.try_pop(val));
+    EXPECT_EQ(0, val);
+    EXPECT_TRUE(ring.try_push(4));
+    int sum = 0;
+    EXPECT_EQ(4ul, ring.consume([&](int v) { sum += v; }));
+    EXPECT_EQ(10, sum);
+    EXPECT_TRUE(ring.empty());
+    EXPECT_FALSE(ring.try_pop(val));
+}
+
+TEST(RingBuffer, ThrowingConsumer)
+{
+    spsc_ring_buffer<::std::string, 8> spsc;
+    mpsc_ring_buffer<::std::string, 8> mpsc;
+    for (auto i = 0; i < 4; ++i) {
+        EXPECT_TRUE(spsc.try_push(::std::to_string(i)));
+        EXPECT_TRUE(mpsc.try_push(::std::to_string(i)));
+    }
+    auto thrower = [](::std::string& s)
+    {
+        if (s == "1")
+            throw ::std::runtime_error{"handler"};
+    };
+    EXPECT_THROW(spsc.consume(thrower), ::std::runtime_error);
+    EXPECT_THROW(mpsc.consume(thrower), ::std::runtime_error);
+    EXPECT_EQ(2ul, spsc.size());
+    EXPECT_EQ(2ul, mpsc.size());
+
+    ::std::string val;
+    EXPECT_TRUE(spsc.try_pop(val));
+    EXPECT_EQ("2", val);
+    EXPECT_TRUE(mpsc.try_pop(val));
+    EXPECT_EQ("2", val);
+}
+
+TEST(RingBuffer, DestroyValues)
+{
+    {
+        spsc_ring_buffer<tracked, 4> spsc;
+        mpsc_ring_buffer<tracked, 4> mpsc;
+        for (auto i = 0; i < 2; ++i) {
+            EXPECT_TRUE(spsc.try_emplace(i));
+            EXPECT_TRUE(mpsc.try_emplace(i));
+        }
+        EXPECT_EQ(1ul, spsc.consume([](tracked&){}, 1));
+        // Pushed after the consumer has cached the tail
+        for (auto i = 0; i < 2; ++i) {
+            EXPECT_TRUE(spsc.try_emplace(i));
+            EXPECT_TRUE(mpsc.try_emplace(i));
+        }
+        EXPECT_EQ(7, tracked::live);
+    }
+    EXPECT_EQ(0, tracked::live);
+}
+
+TEST(RingBuffer, MPSCThrowingConstructor)
+{
+    {
+        mpsc_ring_buffer<tracked, 4> ring;
+        EXPECT_TRUE(ring.try_emplace(1));
+        EXPECT_THROW(ring.try_emplace(-1), ::std::invalid_argument);
+        EXPECT_TRUE(ring.try_emplace(2));
+        ::std::vector<int> values;
+        EXPECT_EQ(2ul, ring.consume([&](tracked& t) { values.push_back(t.value); }));
+        EXPECT_EQ((::std::vector<int>{ 1, 2 }), values);
+        EXPECT_TRUE(ring.empty());
+        // The skipped slot is reusable
+        for (auto i = 0; i < 4; ++i)
+            EXPECT_TRUE(ring.try_emplace(i));
+        EXPECT_EQ(4, tracked::live);
+    }
+    EXPECT_EQ(0, tracked::live);
+}
+
+TEST(RingBuffer, EmplaceArgs)
+{
+    spsc_ring_buffer<::std::vector<int>, 2> spsc;
+    mpsc_ring_buffer<::std::vector<int>, 2> mpsc;
+    EXPECT_TRUE(spsc.try_emplace(3, 1));
+    EXPECT_TRUE(mpsc.try_emplace(3, 1));
+    ::std::vector<int> val;
+    EXPECT_TRUE(spsc.try_pop(val));
+    EXPECT_EQ(3ul, val.size());
+    EXPECT_TRUE(mpsc.try_pop(val));
+    EXPECT_EQ(3ul, val.size());
+}
+
+TEST(TypedBus, PostAndDrain)
+{
+    using bus_type = typed_bus< meta::type_tuple<order, cancel, note> >;
+    static_assert(bus_type::queue_type<cancel>::capacity == 4, "");
+    static_assert(bus_type::queue_type<order>::capacity == 1024, "");
+
+    bus_type bus;
+    EXPECT_TRUE(bus.empty());
+    bus.post<order>(1, 10.5);
+    bus.post<cancel>(1);
+    bus.post<note>("hello");
+    bus.post<order>(order{ 2, 11.0 });
+    EXPECT_EQ(4ul, bus.size());
+    for (auto i = 0; i < 3; ++i)
+        EXPECT_TRUE(bus.try_post<cancel>(i));
+    EXPECT_FALSE(bus.try_post<cancel>(42));
+
+    int orders = 0;
+    double total = 0;
+    int cancels = 0;
+    ::std::string text;
+    struct handler {
+        int&            orders;
+        double&         total;
+        int&            cancels;
+        ::std::string&  text;
+
+        void operator()(order& o) { ++orders; total += o.price; }
+        void operator()(cancel&)  { ++cancels; }
+        void operator()(note& n)  { text = n.text; }
+    } h{ orders, total, cancels, text };
+
+    EXPECT_EQ(2ul, bus.drain<cancel>(h, 2));
+    EXPECT_EQ(2, cancels);
+    EXPECT_EQ(5ul, bus.drain(h));
+    EXPECT_EQ(2, orders);
+    EXPECT_EQ(21.5, total);
+    EXPECT_EQ(4, cancels);
+    EXPECT_EQ("hello", text);
+    EXPECT_TRUE(bus.empty());
+}
+
+TEST(TypedBus, MultiProducer)
+{
+    constexpr int producers = 4;
+    constexpr int messages  = 10000;
+    using bus_type = typed_bus< meta::type_tuple<order, cancel>, multi_producer >;
+    bus_type bus;
+
+    ::std::vector<::std::thread> threads;
+    for (auto p = 0; p < producers; ++p) {
+        threads.emplace_back([&bus, p]() {
+            for (auto i = 0; i < messages; ++i) {
+                if (i % 2)
+                    bus.post<order>(p, 1.0);
+                else
+                    bus.post<cancel>(p);
+            }
+        });
+    }
+
+    long long received = 0;
+    double total = 0;
+    auto handler = [&](auto& msg) {
+        ++received;
+        total += msg.id;
+    };
+    while (received < producers * messages) {
+        if (!bus.drain(handler))
+            ::std::this_thread::yield();
+    }
+    for (auto& t : threads)
+        t.join();
+    EXPECT_EQ(producers * messages, received);
+    EXPECT_EQ((0 + 1 + 2 + 3) * messages, total);
+    EXPECT_TRUE(bus.empty());
+}
+
+using message_pool = typed_pool< meta::type_tuple<order, cancel, note, big, int>, 8 >;
+static_assert(message_pool::class_count == 3, "");
+static_assert(message_pool::class_of<cancel> == 0, "");
+static_assert(message_pool::class_of<int> == 0, "");
+static_assert(message_pool::class_of<order> == 0, "");
+static_assert(message_pool::class_of<note> == 1, "");
+static_assert(message_pool::class_of<big> == 2, "");
+
+TEST(TypedPool, AllocateDeallocate)
+{
+    message_pool pool;
+    ::std::vector< pool_handle<note> > notes;
+    for (auto i = 0; i < 100; ++i)
+        notes.push_back(pool.allocate<note>(::std::to_string(i)));
+    auto o = pool.allocate<order>(1, 2.5);
+    EXPECT_EQ(1, o->id);
+    EXPECT_EQ(2.5, o->price);
+    EXPECT_EQ("42", notes[42]->text);
+
+    auto stats = pool.stats();
+    EXPECT_EQ(100ul, stats.live_of<note>());
+    EXPECT_EQ(1ul, stats.live_of<order>());
+    EXPECT_EQ(0ul, stats.live_of<big>());
+    EXPECT_LE(100ul, stats.reserved[message_pool::class_of<note>]);
+    EXPECT_EQ(0ul, stats.reserved[message_pool::class_of<big>]);
+
+    for (auto& n : notes)
+        pool.deallocate(n);
+    pool.deallocate(o);
+    stats = pool.stats();
+    EXPECT_EQ(0ul, stats.live_of<note>());
+    EXPECT_EQ(0ul, stats.live_of<order>());
+
+    // Slots are reused
+    auto reserved = stats.reserved[message_pool::class_of<note>];
+    for (auto i = 0; i < 100; ++i)
+        notes[i] = pool.allocate<note>("");
+    EXPECT_EQ(reserved, pool.stats().reserved[message_pool::class_of<note>]);
+    for (auto& n : notes)
+        pool.deallocate(n);
+}
+
+TEST(TypedPool, CrossThread)
+{
+    constexpr int threads_count = 4;
+    constexpr int objects       = 1000;
+    message_pool pool;
+    ::std::vector< ::std::vector< pool_handle<big> > > allocated(threads_count);
+    ::std::vector<::std::thread> threads;
+    for (auto t = 0; t < threads_count; ++t) {
+        threads.emplace_back([&pool, &allocated, t]() {
+            for (auto i = 0; i < objects; ++i) {
+                allocated[t].push_back(pool.allocate<big>());
+                allocated[t].back()->data[0] = static_cast<char>(t);
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    EXPECT_EQ(static_cast<::std::size_t>(threads_count * objects), pool.stats().live_of<big>());
+
+    // Deallocate in other threads
+    threads.clear();
+    for (auto t = 0; t < threads_count; ++t) {
+        threads.emplace_back([&pool, &allocated, t]() {
+            for (auto h : allocated[(t + 1) % threads_count])
+                pool.deallocate(h);
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    EXPECT_EQ(0ul, pool.stats().live_of<big>());
+}
+
+TEST(Pipeline, Sink)
+{
+    constexpr int count = 10000;
+    ::std::atomic<long> sum{0};
+    {
+        pipeline< meta::type_tuple<parse_stage, square_stage, sum_stage>, 16, 4 > p{
+            parse_stage{}, square_stage{}, sum_stage{ &sum } };
+        for (auto i = 0; i < count; ++i)
+            p.push(::std::to_string(i % 100));
+        p.close();
+        auto stats = p.stats();
+        for (auto const& s : stats) {
+            EXPECT_EQ(static_cast<::std::size_t>(count), s.processed);
+            EXPECT_LE(s.batches, s.processed);
+            EXPECT_GE(s.batches * 4, s.processed);
+            EXPECT_EQ(0ul, s.queue_depth);
+        }
+    }
+    long expected = 0;
+    for (auto i = 0; i < count; ++i)
+        expected += static_cast<long>(i % 100) * (i % 100);
+    EXPECT_EQ(expected, sum.load());
+}
+
+TEST(Pipeline, Output)
+{
+    constexpr int count = 1000;
+    // A small output queue, the last stage waits for the consumer
+    pipeline< meta::type_tuple<parse_stage, string_stage>, 4, 2 > p;
+    ::std::thread producer{[&p]() {
+        for (auto i = 0; i < count; ++i)
+            p.push(::std::to_string(i));
+    }};
+    ::std::vector<::std::string> results;
+    while (results.size() < static_cast<::std::size_t>(count)) {
+        ::std::string str;
+        if (p.try_pop(str))
+            results.push_back(str);
+        else
+            ::std::this_thread::yield();
+    }
+    producer.join();
+    p.close();
+    for (auto i = 0; i < count; ++i)
+        EXPECT_EQ(::std::to_string(i), results[i]);
+    EXPECT_EQ(static_cast<::std::size_t>(count), p.stats<1>().processed);
+    EXPECT_FALSE(p.try_pop(results.front()));
+}
+
+TEST(Pipeline, PushConverts)
+{
+    constexpr int count = 50;
+    ::std::atomic<::std::size_t> total{0};
+    {
+        // A small queue, push retries the converted value
+        pipeline< meta::type_tuple<text_length_stage>, 2, 1 > p{
+            text_length_stage{ &total } };
+        for (auto i = 0; i < count; ++i)
+            p.push(::std::string{"text"});
+        p.close();
+    }
+    EXPECT_EQ(static_cast<::std::size_t>(count) * 4, total.load());
+}
+
+TEST(Pipeline, Idle)
+{
+    ::std::atomic<long> sum{0};
+    pipeline< meta::type_tuple<parse_stage, square_stage, sum_stage>, 16, 4 > p{
+        parse_stage{}, square_stage{}, sum_stage{ &sum } };
+    for (auto round = 0; round < 3; ++round) {
+        // Let the stages block waiting for input
+        ::std::this_thread::sleep_for(::std::chrono::milliseconds{20});
+        p.push(::std::string{"3"});
+        while (p.stats<2>().processed < static_cast<::std::size_t>(round + 1))
+            ::std::this_thread::yield();
+    }
+    p.close();
+    EXPECT_EQ(27, sum.load());
+}
+
+TEST(Pipeline, DestroyWithFullOutput)
+{
+    // Results are never consumed, the destructor must not wait for space
+    // in the output queue
+    pipeline< meta::type_tuple<parse_stage, string_stage>, 4, 2 > p;
+    for (auto i = 0; i < 8; ++i)
+        p.push(::std::to_string(i));
+    for (auto i = 8; i < 100; ++i)
+        p.try_push(::std::to_string(i));
+}
+
+}  /* namespace test */
+}  /* namespace util */
+}  /* namespace psst */
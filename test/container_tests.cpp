@@ -0,0 +1,418 @@
+/*
+ * container_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#include <gtest/gtest.h>
+#include <pushkin/util/type_bitset.hpp>
+#include <pushkin/util/compact_variant.hpp>
+#include <pushkin/util/static_index_set.hpp>
+#include <pushkin/util/string_pool.hpp>
+#include <pushkin/util/ecs_world.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace psst {
+namespace util {
+namespace test {
+
+namespace {
+
+struct position {};
+struct velocity {};
+struct sprite {};
+struct collider {};
+
+template < ::std::size_t N >
+struct tag {};
+
+template < typename T >
+struct make_tags;
+
+template < ::std::size_t ... N >
+struct make_tags< ::std::index_sequence<N...> > {
+    using type = meta::type_tuple< tag<N>... >;
+};
+
+struct small_msg {
+    ::std::uint32_t id;
+};
+struct tiny_msg {
+    char data[3];
+};
+
+struct counted {
+    static int instances;
+
+    counted() : value{0} { ++instances; }
+    counted(int v) : value{v} { ++instances; }
+    counted(counted const& rhs) : value{rhs.value} { ++instances; }
+    ~counted() { --instances; }
+
+    int value;
+};
+int counted::instances = 0;
+
+/**
+ * Constructible from anything, like std::any. A braced copy of a vector
+ * of these picks the initializer_list constructor.
+ */
+struct anything {
+    anything() = default;
+    template < typename U >
+    anything(U const&) {}
+};
+
+}  /* namespace  */
+
+static_assert(meta::max_of_v<int, 3, 8, 1> == 8, "");
+static_assert(meta::min_of_v<int, 3, 8, 1> == 1, "");
+
+using components    = meta::type_tuple<position, velocity, sprite, collider>;
+using component_set = type_bitset<components>;
+
+static_assert(component_set::word_count == 1, "");
+static_assert(component_set::of<position, sprite>().has<sprite>(), "");
+static_assert(!component_set::of<position, sprite>().has<velocity>(), "");
+static_assert(component_set::of<position, sprite>().count() == 2, "");
+static_assert(component_set::of<position, velocity, sprite>()
+        .matches< meta::type_tuple<position, velocity> >(), "");
+static_assert(!component_set::of<position, velocity, sprite>()
+        .matches< meta::type_tuple<position, velocity>, meta::type_tuple<sprite> >(), "");
+static_assert(component_set::of<position, velocity>()
+        .matches< meta::type_tuple<position, velocity>, meta::type_tuple<sprite> >(), "");
+static_assert(component_set{}.empty(), "");
+
+TEST(TypeBitset, SetOperations)
+{
+    component_set set;
+    EXPECT_TRUE(set.empty());
+    set.insert<position>().insert<velocity>();
+    EXPECT_TRUE(set.has<position>());
+    EXPECT_TRUE(set.has<velocity>());
+    EXPECT_FALSE(set.has<sprite>());
+    EXPECT_EQ(2ul, set.count());
+
+    auto drawable = component_set::of<position, sprite>();
+    EXPECT_TRUE(set.intersects(drawable));
+    EXPECT_FALSE(set.contains(drawable));
+    EXPECT_EQ(component_set::of<position>(), set & drawable);
+    EXPECT_EQ((component_set::of<position, velocity, sprite>()), set | drawable);
+    EXPECT_EQ(component_set::of<velocity>(), set - drawable);
+    EXPECT_TRUE(component_set::of<position>().is_subset_of(set));
+
+    set.erase<position>();
+    EXPECT_FALSE(set.has<position>());
+    EXPECT_FALSE(set.intersects(drawable));
+    set.clear();
+    EXPECT_TRUE(set.empty());
+}
+
+TEST(TypeBitset, MultipleWords)
+{
+    using tags      = typename make_tags< ::std::make_index_sequence<130> >::type;
+    using tag_set   = type_bitset<tags>;
+    static_assert(tag_set::word_count == 3, "");
+
+    auto set = tag_set::of< tag<0>, tag<64>, tag<129> >();
+    EXPECT_EQ(3ul, set.count());
+    EXPECT_TRUE(set.has< tag<129> >());
+    EXPECT_FALSE(set.has< tag<128> >());
+    EXPECT_TRUE((set.matches< meta::type_tuple< tag<64>, tag<129> > >()));
+    EXPECT_FALSE((set.matches< meta::type_tuple< tag<64>, tag<128> > >()));
+    EXPECT_FALSE((set.matches< meta::type_tuple< tag<64> >, meta::type_tuple< tag<0> > >()));
+    EXPECT_TRUE(tag_set::of< tag<129> >().is_subset_of(set));
+    EXPECT_EQ(2ul, set.word(2));
+}
+
+using small_variant = compact_variant< meta::type_tuple<small_msg, tiny_msg> >;
+static_assert(::std::is_same< small_variant::index_type, ::std::uint8_t >::value, "");
+static_assert(sizeof(small_variant) == 2 * sizeof(::std::uint32_t), "");
+static_assert(alignof(small_variant) == alignof(::std::uint32_t), "");
+static_assert(!is_trivially_relocatable<
+        compact_variant< meta::type_tuple<::std::string> > >::value, "");
+static_assert(is_trivially_relocatable<
+        compact_variant< meta::type_tuple<small_msg, tiny_msg>, true > >::value, "");
+
+TEST(CompactVariant, Visit)
+{
+    using variant_type = compact_variant< meta::type_tuple<int, ::std::string, double> >;
+    variant_type var;
+    EXPECT_TRUE(var.valueless());
+    EXPECT_THROW(var.visit([](auto const&) {}), bad_variant_access);
+
+    var = ::std::string{"text"};
+    EXPECT_EQ(1, var.index());
+    EXPECT_TRUE(var.holds<::std::string>());
+    EXPECT_EQ("text", var.get<::std::string>());
+    EXPECT_EQ(nullptr, var.get_if<int>());
+    EXPECT_THROW(var.get<double>(), bad_variant_access);
+
+    auto size = [](auto const& v) { return sizeof(v); };
+    EXPECT_EQ(sizeof(::std::string), var.visit(size));
+    var.emplace<double>(3.5);
+    EXPECT_EQ(sizeof(double), visit(size, var));
+    var.visit([](auto& v) { v = v + v; });
+    EXPECT_EQ(7.0, var.get<double>());
+
+    variant_type const copy{ var };
+    EXPECT_EQ(7.0, copy.get<double>());
+    EXPECT_EQ(sizeof(double), visit(size, copy));
+
+    // Constructor arguments are not taken for an initializer list
+    var.emplace<::std::string>(3ul, 'x');
+    EXPECT_EQ("xxx", var.get<::std::string>());
+
+    var.reset();
+    EXPECT_TRUE(var.valueless());
+}
+
+TEST(CompactVariant, CopyMoveInitializerList)
+{
+    using vector_type = ::std::vector<anything>;
+    using variant_type = compact_variant< meta::type_tuple<int, vector_type> >;
+    variant_type var{ vector_type(3) };
+    EXPECT_EQ(3ul, var.get<vector_type>().size());
+    variant_type copy{ var };
+    EXPECT_EQ(3ul, copy.get<vector_type>().size());
+    variant_type moved{ ::std::move(copy) };
+    EXPECT_EQ(3ul, moved.get<vector_type>().size());
+    copy = var;
+    EXPECT_EQ(3ul, copy.get<vector_type>().size());
+    moved = ::std::move(copy);
+    EXPECT_EQ(3ul, moved.get<vector_type>().size());
+}
+
+TEST(CompactVariant, Lifetime)
+{
+    using variant_type = compact_variant< meta::type_tuple<int, counted> >;
+    {
+        variant_type a{ counted{ 42 } };
+        EXPECT_EQ(1, counted::instances);
+        variant_type b{ a };
+        EXPECT_EQ(2, counted::instances);
+        b = 1;
+        EXPECT_EQ(1, counted::instances);
+        b = ::std::move(a);
+        EXPECT_EQ(2, counted::instances);
+        EXPECT_EQ(42, b.get<counted>().value);
+        ::std::vector<variant_type> vec(10, b);
+        EXPECT_EQ(12, counted::instances);
+    }
+    EXPECT_EQ(0, counted::instances);
+}
+
+template < typename Set >
+void
+check_index_set(::std::vector<int> const& values)
+{
+    ::std::size_t const npos = Set::npos;
+    for (int v = -5; v < 1100; ++v) {
+        auto it = ::std::lower_bound(values.begin(), values.end(), v);
+        auto rank = static_cast<::std::size_t>(it - values.begin());
+        bool found = it != values.end() && *it == v;
+        EXPECT_EQ(found, Set::contains(v)) << v;
+        EXPECT_EQ(rank, Set::rank(v)) << v;
+        EXPECT_EQ(found ? rank : npos, Set::find(v)) << v;
+    }
+}
+
+TEST(StaticIndexSet, Linear)
+{
+    using set = static_index_set< ::std::integer_sequence<int, 42, 7, -3, 100, 7, 0> >;
+    static_assert(set::linear_search, "");
+    static_assert(set::size == 5, "");
+    check_index_set<set>({ -3, 0, 7, 42, 100 });
+}
+
+namespace {
+
+template < typename T >
+struct squares;
+
+template < int ... I >
+struct squares< ::std::integer_sequence<int, I...> > {
+    using type = ::std::integer_sequence<int, (I * I % 1031)...>;
+};
+
+}  /* namespace  */
+
+TEST(StaticIndexSet, Eytzinger)
+{
+    using values = typename squares< ::std::make_integer_sequence<int, 200> >::type;
+    using set = static_index_set< values >;
+    static_assert(!set::linear_search, "");
+    ::std::vector<int> expected;
+    for (int i = 0; i < 200; ++i)
+        expected.push_back(i * i % 1031);
+    ::std::sort(expected.begin(), expected.end());
+    expected.erase(::std::unique(expected.begin(), expected.end()), expected.end());
+    EXPECT_EQ(expected.size(), ::std::size_t{ set::size });
+    check_index_set<set>(expected);
+
+    // Sizes around powers of two
+    check_index_set< static_index_set< ::std::integer_sequence<int, 1, 5, 9>, 0 > >({ 1, 5, 9 });
+    check_index_set< static_index_set< ::std::integer_sequence<int, 1, 5, 9, 13>, 0 > >({ 1, 5, 9, 13 });
+    check_index_set< static_index_set< ::std::integer_sequence<int, 1>, 0 > >({ 1 });
+    check_index_set< static_index_set< ::std::integer_sequence<int>, 0 > >({});
+}
+
+}  /* namespace test */
+
+template <>
+struct is_trivially_relocatable< ::std::unique_ptr<int> > : ::std::true_type {};
+
+namespace test {
+
+TEST(CompactVariant, TriviallyRelocatable)
+{
+    using variant_type = compact_variant<
+            meta::type_tuple< int, ::std::unique_ptr<int> >, true >;
+    variant_type a{ ::std::unique_ptr<int>{ new int{42} } };
+    variant_type b{ ::std::move(a) };
+    EXPECT_TRUE(a.valueless());
+    EXPECT_EQ(42, *b.get<::std::unique_ptr<int>>());
+
+    ::std::vector<variant_type> vec;
+    for (auto i = 0; i < 100; ++i)
+        vec.emplace_back(::std::unique_ptr<int>{ new int{i} });
+    EXPECT_EQ(99, *vec.back().get<::std::unique_ptr<int>>());
+}
+
+using price_name  = meta::char_sequence_literal<'p', 'r', 'i', 'c', 'e'>;
+using qty_name    = meta::char_sequence_literal<'q', 't', 'y'>;
+using empty_name  = meta::char_sequence_literal<>;
+using names_pool  = string_pool< price_name, qty_name, price_name, empty_name >;
+
+static_assert(names_pool::count == 3, "");
+static_assert(names_pool::size == 6 + 4 + 1, "");
+static_assert(names_pool::handle<price_name>() != names_pool::handle<qty_name>(), "");
+static_assert(names_pool::handle<qty_name>().length == 3, "");
+static_assert(names_pool::handle<empty_name>().length == 0, "");
+
+TEST(StringPool, Lookup)
+{
+    EXPECT_STREQ("price", names_pool::c_str<price_name>());
+    EXPECT_STREQ("qty", names_pool::c_str<qty_name>());
+    EXPECT_STREQ("", names_pool::c_str<empty_name>());
+    EXPECT_EQ(names_pool::data() + names_pool::handle<qty_name>().offset,
+            names_pool::c_str<qty_name>());
+    EXPECT_EQ(0u, reinterpret_cast<::std::uintptr_t>(names_pool::data()) % cache_line_size);
+
+    char const qty[]{ 'q', 't', 'y', 'x' };
+    EXPECT_TRUE(names_pool::find(qty, 3) == names_pool::handle<qty_name>());
+    EXPECT_FALSE(names_pool::find(qty, 4).valid());
+    EXPECT_FALSE(names_pool::find("pric").valid());
+    EXPECT_TRUE(names_pool::find("") == names_pool::handle<empty_name>());
+    EXPECT_EQ(names_pool::c_str<price_name>(), names_pool::c_str(names_pool::find("price")));
+}
+
+TEST(StringPool, EmbeddedNull)
+{
+    using nul_name  = meta::char_sequence_literal<'a', '\0', 'b'>;
+    using pool      = string_pool< nul_name, qty_name >;
+    char const nul[]{ 'a', '\0', 'b' };
+    EXPECT_TRUE(pool::find(nul, 3) == pool::handle<nul_name>());
+    EXPECT_FALSE(pool::find(nul, 1).valid());
+    EXPECT_TRUE(pool::find("qty") == pool::handle<qty_name>());
+}
+
+struct ecs_position {
+    float x, y;
+};
+struct ecs_velocity {
+    float x, y;
+};
+struct ecs_sleeping {};
+
+using ecs_components = meta::type_tuple< ecs_position, ecs_velocity, ecs_sleeping, ::std::string >;
+using world_type = ecs_world< ecs_components >;
+
+static_assert( ::std::is_same<
+        world_type::archetype_of_t< ecs_sleeping, ecs_velocity, ecs_position, ecs_velocity >,
+        meta::type_tuple< ecs_position, ecs_velocity, ecs_sleeping > >::value, "");
+
+TEST(EcsWorld, CreateAndQuery)
+{
+    world_type world;
+    ::std::vector<entity> entities;
+    for (auto i = 0; i < 10; ++i) {
+        if (i % 2)
+            entities.push_back(world.create(ecs_position{ 0, 0 }, ecs_velocity{ 1.0f * i, 0 }));
+        else
+            entities.push_back(world.create(ecs_velocity{ 1.0f * i, 0 }, ecs_position{ 0, 0 }, ecs_sleeping{}));
+    }
+    entities.push_back(world.create(ecs_position{ 5, 5 }));
+    EXPECT_EQ(11ul, world.size());
+    EXPECT_EQ(3ul, world.archetype_count());
+
+    world_type::query< meta::type_tuple<ecs_position, ecs_velocity> > all{ world };
+    world_type::query< meta::type_tuple<ecs_position, ecs_velocity>,
+        meta::type_tuple<ecs_sleeping> > awake{ world };
+    EXPECT_EQ(10ul, all.size());
+    EXPECT_EQ(5ul, awake.size());
+
+    awake.each([](ecs_position& p, ecs_velocity const& v) { p.x += v.x; });
+    for (auto i = 0; i < 10; ++i) {
+        EXPECT_EQ(i % 2 ? 1.0f * i : 0.0f, world.get<ecs_position>(entities[i])->x) << i;
+    }
+    EXPECT_EQ(5.0f, world.get<ecs_position>(entities[10])->x);
+    EXPECT_EQ(nullptr, world.get<ecs_velocity>(entities[10]));
+
+    ::std::size_t count = 0;
+    world.each< meta::type_tuple<ecs_sleeping> >([&](ecs_sleeping&) { ++count; });
+    EXPECT_EQ(5ul, count);
+
+    awake.each_entity([&](entity e, ecs_position&, ecs_velocity&) {
+        EXPECT_FALSE(world.has<ecs_sleeping>(e));
+    });
+}
+
+TEST(EcsWorld, ChangeComponents)
+{
+    world_type world;
+    auto a = world.create(ecs_position{ 1, 1 }, ::std::string{ "a" });
+    auto b = world.create(ecs_position{ 2, 2 }, ::std::string{ "b" });
+    auto c = world.create(ecs_position{ 3, 3 }, ::std::string{ "c" });
+
+    world.add(a, ecs_velocity{ 1, 1 });
+    EXPECT_TRUE(world.has<ecs_velocity>(a));
+    EXPECT_EQ("a", *world.get<::std::string>(a));
+    EXPECT_EQ("c", *world.get<::std::string>(c));
+    EXPECT_EQ(2.0f, world.get<ecs_position>(b)->x);
+
+    world.add(a, ecs_velocity{ 2, 2 });
+    EXPECT_EQ(2.0f, world.get<ecs_velocity>(a)->x);
+
+    world.remove<::std::string>(b);
+    EXPECT_FALSE(world.has<::std::string>(b));
+    EXPECT_EQ(2.0f, world.get<ecs_position>(b)->x);
+    EXPECT_EQ("c", *world.get<::std::string>(c));
+
+    world.destroy(c);
+    EXPECT_FALSE(world.alive(c));
+    EXPECT_EQ(nullptr, world.get<ecs_position>(c));
+    EXPECT_EQ(2ul, world.size());
+
+    auto d = world.create(ecs_position{ 4, 4 });
+    EXPECT_EQ(c.index, d.index);
+    EXPECT_NE(c, d);
+    EXPECT_FALSE(world.alive(c));
+    EXPECT_TRUE(world.alive(d));
+
+    world_type::query< meta::type_tuple<ecs_position> > positions{ world };
+    float sum = 0;
+    positions.each([&](ecs_position const& p) { sum += p.x; });
+    EXPECT_EQ(1.0f + 2.0f + 4.0f, sum);
+}
+
+}  /* namespace test */
+}  /* namespace util */
+}  /* namespace psst */
@@ -0,0 +1,235 @@
+/*
+ * dispatch_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#include <gtest/gtest.h>
+#include <pushkin/meta/multi_dispatch.hpp>
+#include <pushkin/util/rpc_dispatcher.hpp>
+#include <pushkin/util/state_machine.hpp>
+
+#include <string>
+#include <vector>
+
+namespace psst {
+namespace util {
+namespace test {
+
+static_assert(::std::is_same<
+        meta::function_args_t< void(*)(int, double) >,
+        meta::type_tuple<int, double> >::value, "");
+static_assert(::std::is_same<
+        meta::function_args_t< void(*)(::std::tuple<int, double>) >,
+        meta::type_tuple< ::std::tuple<int, double> > >::value, "");
+static_assert(::std::is_same<
+        meta::function_args_t< void(*)() >,
+        meta::type_tuple<> >::value, "");
+
+TEST(RpcDispatcher, DispatchByOpcode)
+{
+    int called_a = 0;
+    int called_b = 0;
+    int sum = 0;
+    double dbl = 0;
+    auto dispatcher = make_rpc_dispatcher(
+        [&](int a, int const& b, double c) { ++called_a; sum = a + b; dbl = c; },
+        [&]() { ++called_b; });
+
+    ::std::vector<char> buffer(encoded_size(1, 2, 3.5));
+    EXPECT_EQ(buffer.data() + buffer.size(), encode(buffer.data(), 1, 2, 3.5));
+
+    EXPECT_TRUE(dispatcher.dispatch(0, buffer.data(), buffer.size()));
+    EXPECT_EQ(1, called_a);
+    EXPECT_EQ(3, sum);
+    EXPECT_EQ(3.5, dbl);
+
+    EXPECT_TRUE(dispatcher.dispatch(1, nullptr, 0));
+    EXPECT_EQ(1, called_b);
+
+    // Unknown opcode
+    EXPECT_FALSE(dispatcher.dispatch(2, nullptr, 0));
+    // Truncated and oversized payloads
+    EXPECT_FALSE(dispatcher.dispatch(0, buffer.data(), buffer.size() - 1));
+    EXPECT_FALSE(dispatcher.dispatch(1, buffer.data(), 1));
+    EXPECT_EQ(1, called_a);
+    EXPECT_EQ(1, called_b);
+}
+
+#if __cplusplus >= 201703L
+TEST(RpcDispatcher, StringViewInPlace)
+{
+    char const* begin = nullptr;
+    ::std::string name;
+    ::std::uint16_t id = 0;
+    auto dispatcher = make_rpc_dispatcher(
+        [&](::std::uint16_t i, ::std::string_view n) {
+            id = i; name = ::std::string{n}; begin = n.data();
+        });
+
+    ::std::string_view src{"test name"};
+    ::std::vector<char> buffer(encoded_size(::std::uint16_t{42}, src));
+    encode(buffer.data(), ::std::uint16_t{42}, src);
+
+    EXPECT_TRUE(dispatcher.dispatch(0, buffer.data(), buffer.size()));
+    EXPECT_EQ(42, id);
+    EXPECT_EQ("test name", name);
+    EXPECT_EQ(buffer.data() + sizeof(::std::uint16_t) + sizeof(::std::uint32_t), begin);
+
+    EXPECT_FALSE(dispatcher.dispatch(0, buffer.data(), buffer.size() - 1));
+}
+#endif
+
+struct circle {};
+struct box {};
+struct polygon {};
+
+using shapes = meta::type_tuple<circle, box, polygon>;
+using materials = meta::type_tuple<int, double>;
+
+template < typename T >
+constexpr int
+type_code(meta::type_constant<T>);
+constexpr int
+type_code(meta::type_constant<circle>)
+{ return 1; }
+constexpr int
+type_code(meta::type_constant<box>)
+{ return 2; }
+constexpr int
+type_code(meta::type_constant<polygon>)
+{ return 3; }
+constexpr int
+type_code(meta::type_constant<int>)
+{ return 4; }
+constexpr int
+type_code(meta::type_constant<double>)
+{ return 5; }
+
+template < typename A, typename B >
+struct collidable : ::std::integral_constant<bool,
+        !::std::is_same<A, polygon>::value && !::std::is_same<B, polygon>::value> {};
+
+TEST(MultiDispatch, Dense)
+{
+    auto code = [](auto a, auto b) { return type_code(a) * 10 + type_code(b); };
+    for (::std::size_t i = 0; i < shapes::size; ++i) {
+        for (::std::size_t j = 0; j < shapes::size; ++j) {
+            EXPECT_EQ(static_cast<int>((i + 1) * 10 + j + 1),
+                    (meta::multi_dispatch<shapes, shapes>(i, j, code)));
+        }
+    }
+    EXPECT_EQ(325, (meta::multi_dispatch<shapes, shapes, materials>(2, 1, 1,
+            [](auto a, auto b, auto c) { return type_code(a) * 100 + type_code(b) * 10 + type_code(c); })));
+
+    int calls = 0;
+    meta::multi_dispatch<materials>(0, [&](auto) { ++calls; });
+    EXPECT_EQ(1, calls);
+}
+
+TEST(MultiDispatch, Sparse)
+{
+    auto code = [](auto a, auto b) { return type_code(a) * 10 + type_code(b); };
+    auto fallback = [](::std::size_t a, ::std::size_t b) { return -static_cast<int>(a * 10 + b); };
+    EXPECT_EQ(12, (meta::multi_dispatch_sparse<collidable, shapes, shapes>(0, 1, code, fallback)));
+    EXPECT_EQ(22, (meta::multi_dispatch_sparse<collidable, shapes, shapes>(1, 1, code, fallback)));
+    EXPECT_EQ(-21, (meta::multi_dispatch_sparse<collidable, shapes, shapes>(2, 1, code, fallback)));
+    EXPECT_EQ(-12, (meta::multi_dispatch_sparse<collidable, shapes, shapes>(1, 2, code, fallback)));
+    EXPECT_EQ(-15, (meta::multi_dispatch_sparse<collidable, shapes, shapes>(1, 5, code, fallback)));
+}
+
+namespace fsm {
+
+struct idle {};
+struct connecting {};
+struct online {};
+
+struct connect {};
+struct connected {};
+struct disconnect {
+    int reason;
+};
+
+struct connection {
+    int connects    = 0;
+    int reason      = 0;
+};
+
+struct start_connect {
+    void
+    operator()(connection& conn, connect const&) const
+    { ++conn.connects; }
+};
+
+struct close_socket {
+    void
+    operator()(connection& conn, disconnect const& ev) const
+    { conn.reason = ev.reason; }
+};
+
+int disconnects = 0;
+
+struct count_disconnect {
+    void
+    operator()(disconnect const&) const
+    { ++disconnects; }
+};
+
+using transitions = make_transition_map_t<
+    transition< idle,       connect,    connecting, start_connect >,
+    transition< connecting, connected,  online >,
+    transition< connecting, disconnect, idle,       close_socket >,
+    transition< online,     disconnect, idle,       close_socket >
+>;
+
+}  /* namespace fsm */
+
+TEST(StateMachine, ProcessEvents)
+{
+    using machine = state_machine<fsm::transitions, fsm::connection>;
+    static_assert(machine::states::size == 3, "");
+    static_assert(machine::events::size == 3, "");
+    static_assert(::std::is_same<machine::initial_state, fsm::idle>::value, "");
+    static_assert(sizeof(machine::state_index) == 1, "");
+
+    machine m;
+    EXPECT_TRUE(m.is_in_state<fsm::idle>());
+    EXPECT_FALSE(m.process_event(fsm::connected{}));
+    EXPECT_TRUE(m.is_in_state<fsm::idle>());
+
+    EXPECT_TRUE(m.process_event(fsm::connect{}));
+    EXPECT_TRUE(m.is_in_state<fsm::connecting>());
+    EXPECT_EQ(1, m.context().connects);
+
+    EXPECT_FALSE(m.process_event(fsm::connect{}));
+    EXPECT_TRUE(m.is_in_state<fsm::connecting>());
+    EXPECT_TRUE(m.process_event(fsm::connected{}));
+    EXPECT_TRUE(m.is_in_state<fsm::online>());
+
+    EXPECT_TRUE(m.process_event(fsm::disconnect{42}));
+    EXPECT_TRUE(m.is_in_state<fsm::idle>());
+    EXPECT_EQ(42, m.context().reason);
+
+    m.process_event(fsm::connect{});
+    m.reset();
+    EXPECT_TRUE(m.is_in_state<fsm::idle>());
+
+}
+
+TEST(StateMachine, NoContext)
+{
+    state_machine< make_transition_map_t<
+        transition< fsm::idle,   fsm::connect,    fsm::online >,
+        transition< fsm::online, fsm::disconnect, fsm::idle, fsm::count_disconnect > > > m;
+    fsm::disconnects = 0;
+    EXPECT_TRUE(m.process_event(fsm::connect{}));
+    EXPECT_TRUE(m.is_in_state<fsm::online>());
+    EXPECT_TRUE(m.process_event(fsm::disconnect{}));
+    EXPECT_TRUE(m.is_in_state<fsm::idle>());
+    EXPECT_EQ(1, fsm::disconnects);
+}
+
+}  /* namespace test */
+}  /* namespace util */
+}  /* namespace psst */
@@ -0,0 +1,139 @@
+/*
+ * record_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#include <gtest/gtest.h>
+#include <pushkin/util/record_file.hpp>
+#include <pushkin/meta/packed_layout.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace psst {
+namespace util {
+namespace test {
+
+using trade = meta::type_tuple< ::std::int64_t, double, ::std::uint32_t, char >;
+using trade_layout = meta::record_layout<trade>;
+
+struct trade_struct {
+    ::std::int64_t  timestamp;
+    double          price;
+    ::std::uint32_t qty;
+    char            side;
+};
+
+static_assert(trade_layout::offset<0> == offsetof(trade_struct, timestamp), "");
+static_assert(trade_layout::offset<1> == offsetof(trade_struct, price), "");
+static_assert(trade_layout::offset<2> == offsetof(trade_struct, qty), "");
+static_assert(trade_layout::offset<3> == offsetof(trade_struct, side), "");
+static_assert(trade_layout::size == sizeof(trade_struct), "");
+static_assert(trade_layout::alignment == alignof(trade_struct), "");
+static_assert(meta::record_layout< meta::type_tuple<char, ::std::uint16_t, char> >::size == 6, "");
+static_assert(trade_layout::schema_hash != meta::record_layout<
+        meta::type_tuple< ::std::int64_t, double, ::std::int32_t, char > >::schema_hash, "");
+static_assert(trade_layout::schema_hash != meta::record_layout<
+        meta::type_tuple< ::std::int64_t, double, ::std::uint32_t > >::schema_hash, "");
+
+using wire_header = meta::packed_layout<
+        meta::type_tuple< ::std::uint8_t, ::std::uint16_t, ::std::uint32_t, double >,
+        meta::byte_order::big >;
+
+static_assert(wire_header::offset<0> == 0, "");
+static_assert(wire_header::offset<1> == 1, "");
+static_assert(wire_header::offset<2> == 3, "");
+static_assert(wire_header::offset<3> == 7, "");
+static_assert(wire_header::size == 15, "");
+
+TEST(PackedLayout, BigEndian)
+{
+    unsigned char buffer[wire_header::size + 1]{};
+    // Unaligned start of the record
+    auto record = buffer + 1;
+    wire_header::store<0>(record, 7);
+    wire_header::store<1>(record, 0x0102);
+    wire_header::store<2>(record, 0x0a0b0c0du);
+    wire_header::store<3>(record, 2.5);
+
+    unsigned char const expected[]{ 7, 1, 2, 0x0a, 0x0b, 0x0c, 0x0d };
+    EXPECT_EQ(0, ::std::memcmp(expected, record, sizeof(expected)));
+
+    EXPECT_EQ(7, wire_header::load<0>(record));
+    EXPECT_EQ(0x0102, wire_header::load<1>(record));
+    EXPECT_EQ(0x0a0b0c0du, wire_header::load<2>(record));
+    EXPECT_EQ(2.5, wire_header::load<3>(record));
+}
+
+TEST(PackedLayout, Native)
+{
+    using layout = meta::packed_layout< meta::type_tuple< char, ::std::int32_t > >;
+    unsigned char buffer[layout::size];
+    layout::store<0>(buffer, 'x');
+    layout::store<1>(buffer, -42);
+    ::std::int32_t raw;
+    ::std::memcpy(&raw, buffer + 1, sizeof(raw));
+    EXPECT_EQ(-42, raw);
+    EXPECT_EQ('x', layout::load<0>(buffer));
+    EXPECT_EQ(-42, layout::load<1>(buffer));
+}
+
+TEST(RecordFile, WriteAndMap)
+{
+    auto path = ::testing::TempDir() + "pushkin_records.bin";
+    {
+        record_writer<trade> writer{ path };
+        for (auto i = 0; i < 1000; ++i)
+            writer.append(i, i * 0.5, 10u * i, i % 2 ? 'b' : 's');
+        EXPECT_EQ(1000ul, writer.size());
+    }
+
+    record_view<trade> view{ path };
+    ASSERT_EQ(1000ul, view.size());
+    EXPECT_EQ(42, view.get<0>(42));
+    EXPECT_EQ(21.0, view.get<1>(42));
+    EXPECT_EQ(420u, view.get<2>(42));
+    EXPECT_EQ('b', view.get<3>(999));
+    EXPECT_THROW(view.get<0>(1000), ::std::out_of_range);
+
+    double total = 0;
+    for (::std::size_t i = 0; i < view.size(); ++i)
+        total += view.get_unchecked<1>(i);
+    EXPECT_EQ(999 * 1000 / 4.0, total);
+
+    auto moved = ::std::move(view);
+    EXPECT_EQ(1000ul, moved.size());
+    EXPECT_TRUE(view.empty());
+
+    // Wrong schema
+    using other = meta::type_tuple< ::std::int64_t, double >;
+    EXPECT_THROW(record_view<other>{ path }, record_file_error);
+    ::std::remove(path.c_str());
+}
+
+TEST(RecordFile, Errors)
+{
+    auto path = ::testing::TempDir() + "pushkin_not_records.bin";
+    EXPECT_THROW(record_view<trade>{ path }, ::std::system_error);
+    {
+        ::std::ofstream file{ path };
+        file << "not a record file, but long enough to have a header";
+    }
+    EXPECT_THROW(record_view<trade>{ path }, record_file_error);
+
+    {
+        record_writer<trade> writer{ path };
+        writer.append(1, 1.0, 1u, 'b');
+        writer.append(2, 2.0, 2u, 's');
+    }
+    ::truncate(path.c_str(), 64 + trade_layout::size);
+    EXPECT_THROW(record_view<trade>{ path }, record_file_error);
+    ::std::remove(path.c_str());
+}
+
+}  /* namespace test */
+}  /* namespace util */
+}  /* namespace psst */
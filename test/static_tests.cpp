@@ -7,6 +7,19 @@
 
 #include <gtest/gtest.h>
 #include <pushkin/meta.hpp>
+#include <pushkin/meta/type_id.hpp>
+#include <pushkin/meta/static_for.hpp>
+#include <pushkin/meta/parse_number.hpp>
+#include <pushkin/meta/canonical.hpp>
+#include <pushkin/meta/function_traits.hpp>
+#include <pushkin/util/demangle.hpp>
+
+#include <array>
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
 
 namespace psst {
 namespace meta {
@@ -78,6 +91,78 @@ static_assert(is_callable<test_callable, int, double>::value, "");
 static_assert(is_callable<test_callable, int, int>::value, "");
 static_assert(!is_callable<test_callable, int>::value, "");
 
+struct final_callable final {
+    int
+    operator() (int) const;
+};
+struct final_not_callable final {};
+struct reference_callable {
+    int&
+    operator() (int&) const;
+};
+struct lambda_like {
+    int
+    operator() (int, long) const;
+};
+
+static_assert(is_callable<final_callable, int>::value, "");
+static_assert(!is_callable<final_callable, int, int>::value, "");
+static_assert(!is_callable<final_not_callable>::value, "");
+static_assert(is_callable<int(*)(int), long>::value, "");
+static_assert(is_callable<reference_callable, int&>::value, "");
+static_assert(!is_callable<reference_callable, int>::value, "");
+static_assert(is_callable<int&(*)(int&), int&>::value, "");
+
+static_assert(is_callable_object<test_callable>::value, "");
+static_assert(is_callable_object<lambda_like>::value, "");
+static_assert(is_callable_object<final_callable>::value, "");
+static_assert(!is_callable_object<final_not_callable>::value, "");
+static_assert(!is_callable_object<int>::value, "");
+static_assert(function_traits<final_callable>::arity == 1, "");
+static_assert(function_traits<lambda_like>::arity == 2, "");
+
+struct qualified_members {
+    int
+    lvalue(int) &;
+    int
+    rvalue(int, int) const &&;
+    void
+    cv() const volatile;
+    int
+    printf_like(char const*, ...) const;
+};
+
+static_assert(function_traits<decltype(&qualified_members::lvalue)>::ref
+        == ref_qualifier::lvalue, "");
+static_assert(!function_traits<decltype(&qualified_members::lvalue)>::is_const, "");
+static_assert(function_traits<decltype(&qualified_members::rvalue)>::ref
+        == ref_qualifier::rvalue, "");
+static_assert(function_traits<decltype(&qualified_members::rvalue)>::is_const, "");
+static_assert(function_traits<decltype(&qualified_members::rvalue)>::arity == 2, "");
+static_assert(function_traits<decltype(&qualified_members::cv)>::is_volatile, "");
+static_assert(function_traits<decltype(&qualified_members::cv)>::arity == 0, "");
+static_assert(function_traits<decltype(&qualified_members::printf_like)>::is_variadic, "");
+static_assert(function_traits<decltype(&qualified_members::printf_like)>::arity == 1, "");
+static_assert(::std::is_same<
+        function_traits<decltype(&qualified_members::printf_like)>::class_type,
+        qualified_members >::value, "");
+static_assert(function_traits<int(*)(char const*, ...)>::is_variadic, "");
+static_assert(!function_traits<int(*)(char const*)>::is_variadic, "");
+static_assert(!function_traits<int(*)(char const*)>::is_noexcept, "");
+static_assert(function_traits<void(int)>::arity == 1, "");
+
+#if __cpp_noexcept_function_type >= 201510L
+struct noexcept_callable {
+    int
+    operator() (int) const noexcept;
+};
+static_assert(function_traits<int(*)(int) noexcept>::is_noexcept, "");
+static_assert(function_traits<void(int, ...) noexcept>::is_variadic, "");
+static_assert(function_traits<noexcept_callable>::is_noexcept, "");
+static_assert(function_traits<int(qualified_members::*)() const && noexcept>::is_noexcept, "");
+static_assert(!function_traits<lambda_like>::is_noexcept, "");
+#endif
+
 template <typename T, typename Y>
 struct size_less : std::integral_constant<bool, (sizeof(T) < sizeof(Y))> {};
 
@@ -87,6 +172,235 @@ static_assert( ::std::is_same<
         stable_sort_t<size_less, type_set_3>,
         type_tuple<char, bool, short, int, long> >::value, "");
 
+static_assert( index_of_v< int, type_set_3 > == 2, "" );
+static_assert( index_of_v< double, type_set_3 > == ::std::numeric_limits<::std::size_t>::max(), "" );
+static_assert( dense_type_id_v< char, type_set_3 > == 3, "" );
+
+#if __cplusplus >= 201703L
+namespace {
+struct anonymous_type {};
+}  /* namespace */
+
+template < typename T >
+struct test_template {};
+enum class test_enum {};
+
+static_assert(util::type_name<int>() == "int");
+static_assert(util::type_name<test_callable>() == "psst::meta::test::test_callable");
+static_assert(util::type_name<anonymous_type>()
+        == "psst::meta::test::(anonymous namespace)::anonymous_type");
+static_assert(util::type_name<test_template<test_enum const*>>()
+        == "psst::meta::test::test_template<const psst::meta::test::test_enum*>");
+static_assert(util::type_name<::std::vector<::std::vector<int>>>()
+        == "std::vector<std::vector<int>>");
+static_assert(util::type_name<int(*)(long, char const&)>() == "int (*)(long, const char&)");
+static_assert(util::type_name<::std::map<unsigned short, long long>>()
+        == "std::map<unsigned short, long long>");
+static_assert(util::type_name<int>().data()[3] == 0);
+
+static_assert(type_id_v<int> != type_id_v<unsigned int>);
+static_assert(type_id_v<test_template<int>> != type_id_v<test_template<long>>);
+// FNV-1a of "int"
+static_assert(type_id_v<int> == 0x2b9fff192bd4c83eull);
+
+static_assert(::std::is_same<
+        canonical_t<int, float, double>, canonical_t<double, int, float, int> >::value);
+static_assert(::std::is_same<
+        canonical_t<type_tuple<int, float>>, canonical_t<float, int> >::value);
+static_assert(canonical_t<int, float, int>::size == 2);
+static_assert(::std::is_same< canonical_t<>, type_tuple<> >::value);
+static_assert(same_set_v< type_tuple<int, float, int>, type_tuple<float, int> >);
+static_assert(!same_set_v< type_tuple<int, float>, type_tuple<float, long> >);
+static_assert(::std::is_same<
+        canonical_combine_t< type_tuple<int, float>, type_tuple<long> >,
+        canonical_t< long, float, int > >::value);
+static_assert(::std::is_same<
+        canonical_type_map_t< type_tuple<int, float>, type_tuple<char, bool> >,
+        canonical_type_map_t< type_tuple<float, int>, type_tuple<bool, char> > >::value);
+static_assert(::std::is_same<
+        canonical_type_map_t< type_tuple<int, float>, type_tuple<char, bool> >::key_types,
+        canonical_t< int, float > >::value);
+
+constexpr int
+type_id_switch(::std::uint64_t id)
+{
+    switch (id) {
+        case type_id_v<int>:    return 1;
+        case type_id_v<long>:   return 2;
+        default:                return 0;
+    }
+}
+static_assert(type_id_switch(type_id<long>::value) == 2);
+
+TEST(TypeName, Demangle)
+{
+    EXPECT_EQ("psst::meta::test::test_callable", util::demangle<test_callable>());
+}
+#endif
+
+static_assert(::std::is_same<
+        sort_t< ::std::integer_sequence<int, 5, -1, 3, 3, 0> >,
+        ::std::integer_sequence<int, -1, 0, 3, 3, 5> >::value, "");
+static_assert(::std::is_same<
+        sort_t< ::std::integer_sequence<int> >,
+        ::std::integer_sequence<int> >::value, "");
+static_assert(::std::is_same<
+        unique_t< ::std::integer_sequence<int, 5, 1, 5, 3, 1> >,
+        ::std::integer_sequence<int, 5, 1, 3> >::value, "");
+static_assert(::std::is_same<
+        unique_t< ::std::integer_sequence<int> >,
+        ::std::integer_sequence<int> >::value, "");
+static_assert(lower_bound_v< ::std::integer_sequence<int, 1, 3, 3, 7>, 3 > == 1, "");
+static_assert(lower_bound_v< ::std::integer_sequence<int, 1, 3, 3, 7>, 4 > == 3, "");
+static_assert(lower_bound_v< ::std::integer_sequence<int, 1, 3, 3, 7>, 8 > == 4, "");
+static_assert(lower_bound_v< ::std::integer_sequence<int>, 8 > == 0, "");
+
+static_assert(sum_v< ::std::integer_sequence<int, 1, 2, 3, 4> > == 10, "");
+static_assert(sum_v< ::std::integer_sequence<int> > == 0, "");
+static_assert(nth_value_v< 2, ::std::integer_sequence<int, 5, 6, 7> > == 7, "");
+static_assert( ::std::is_same<
+        inclusive_scan_t< ::std::index_sequence<1, 2, 4, 8> >,
+        ::std::index_sequence<1, 3, 7, 15> >::value, "");
+static_assert( ::std::is_same<
+        exclusive_scan_t< ::std::index_sequence<1, 2, 4, 8> >,
+        ::std::index_sequence<0, 1, 3, 7> >::value, "");
+static_assert( ::std::is_same<
+        exclusive_scan_t< ::std::index_sequence<> >,
+        ::std::index_sequence<> >::value, "");
+
+namespace number_literals {
+
+using namespace ::psst::meta::literals;
+
+static_assert( ::std::is_same< decltype(0x1F_cs), char_sequence<'0', 'x', '1', 'F'> >::value, "");
+static_assert(parse_integer_v< int, decltype(1234_cs) > == 1234, "");
+static_assert(parse_integer_v< int, decltype(0x1F_cs) > == 31, "");
+static_assert(parse_integer_v< int, decltype(0b1010_cs) > == 10, "");
+static_assert(parse_integer_v< int, decltype(0755_cs) > == 493, "");
+static_assert(parse_integer_v< int, decltype(0_cs) > == 0, "");
+static_assert(parse_integer_v< long, decltype(1'000'000_cs) > == 1000000, "");
+static_assert(parse_integer_v< ::std::uint8_t, decltype(255_cs) > == 255, "");
+static_assert(parse_integer_v< ::std::int8_t, char_sequence<'-', '1', '2', '8'> > == -128, "");
+static_assert(parse_integer_v< ::std::uint64_t, decltype(0xffffffffffffffff_cs) >
+        == ::std::numeric_limits<::std::uint64_t>::max(), "");
+static_assert(decltype(to_integral<unsigned>(0xff00_cs))::value == 0xff00, "");
+static_assert(::std::is_same< ::std::integer_sequence<int, 1, 2, 3>,
+        ::std::integer_sequence<int, parse_integer_v<int, decltype(1_cs)>,
+            parse_integer_v<int, decltype(2_cs)>, parse_integer_v<int, decltype(3_cs)>> >::value, "");
+
+static_assert(detail::parse_integer<::std::uint8_t>(decltype(256_cs){}).error
+        == parse_error::overflow, "");
+static_assert(detail::parse_integer<::std::int8_t>(char_sequence<'-', '1', '2', '9'>{}).error
+        == parse_error::overflow, "");
+static_assert(detail::parse_integer<int>(char_sequence<'0', 'x'>{}).error == parse_error::empty, "");
+static_assert(detail::parse_integer<int>(char_sequence<'0', '8', '9'>{}).error
+        == parse_error::invalid_digit, "");
+static_assert(detail::parse_integer<unsigned>(char_sequence<'-', '1'>{}).error
+        == parse_error::invalid_digit, "");
+
+static_assert(parse_fixed_v< int, 2, decltype(12.5_cs) > == 1250, "");
+static_assert(parse_fixed_v< int, 3, decltype(0.125_cs) > == 125, "");
+static_assert(parse_fixed_v< int, 2, decltype(7_cs) > == 700, "");
+static_assert(parse_fixed_v< int, 2, decltype(1.2500_cs) > == 125, "");
+static_assert(parse_fixed_v< int, 2, char_sequence<'-', '3', '.', '1', '4'> > == -314, "");
+static_assert(detail::parse_fixed<int, 2>(decltype(1.255_cs){}).error
+        == parse_error::precision_loss, "");
+
+static_assert(parse_double_v< decltype(1.5_cs) > == 1.5, "");
+static_assert(parse_double_v< decltype(0.1_cs) > == 0.1, "");
+static_assert(parse_double_v< decltype(1e22_cs) > == 1e22, "");
+static_assert(parse_double_v< decltype(1e30_cs) > == 1e30, "");
+static_assert(parse_double_v< decltype(3.14159265358979_cs) > == 3.14159265358979, "");
+static_assert(parse_double_v< decltype(2.5e-3_cs) > == 2.5e-3, "");
+static_assert(parse_double_v< decltype(0.0_cs) > == 0.0, "");
+static_assert(detail::parse_double(decltype(1e400_cs){}).error == parse_error::overflow, "");
+
+}  /* namespace number_literals */
+
+#if __cplusplus >= 202002L
+namespace fixed_strings {
+
+constexpr char hello_str[] = "hello";
+
+static_assert( ::std::is_same< char_sequence_of<"hello">,
+        char_sequence<'h', 'e', 'l', 'l', 'o'> >::value, "");
+static_assert( ::std::is_same< char_sequence_of<"hello">,
+        make_char_sequence<hello_str> >::value, "");
+static_assert( ::std::is_same< char_sequence_of<"">, char_sequence<> >::value, "");
+static_assert( ::std::is_same< char_literal_of<"hello">,
+        make_char_literal_s<hello_str> >::value, "");
+static_assert( char_literal_of<"hello">::eq("hello"), "");
+
+using namespace ::psst::meta::literals;
+static_assert( ::std::is_same< decltype("hello"_cs), char_sequence_of<"hello"> >::value, "");
+static_assert(parse_integer_v< int, decltype("-42"_cs) > == -42, "");
+
+}  /* namespace fixed_strings */
+#endif
+
+TEST(StaticFor, TypeTuple)
+{
+    ::std::size_t total_size = 0;
+    static_for< type_tuple<char, short, double> >([&](auto t) {
+        total_size += sizeof(typename decltype(t)::type);
+    });
+    EXPECT_EQ(sizeof(char) + sizeof(short) + sizeof(double), total_size);
+    static_for< type_tuple<> >([](auto) { FAIL(); });
+}
+
+TEST(StaticFor, IntegerSequence)
+{
+    ::std::tuple<int, long, short> tuple{ 1, 2, 3 };
+    ::std::vector<::std::size_t> order;
+    long sum = 0;
+    static_for< ::std::make_index_sequence<3> >([&](auto i) {
+        order.push_back(i.value);
+        sum += ::std::get<decltype(i)::value>(tuple);
+    });
+    EXPECT_EQ((::std::vector<::std::size_t>{ 0, 1, 2 }), order);
+    EXPECT_EQ(6, sum);
+}
+
+TEST(StaticFor, ForEach)
+{
+    ::std::tuple<int, double, ::std::string> tuple{ 1, 2.5, "x" };
+    ::std::string str;
+    for_each(tuple, [&](auto& v) {
+        ::std::ostringstream os;
+        os << v;
+        str += os.str();
+        v = v + v;
+    });
+    EXPECT_EQ("12.5x", str);
+    EXPECT_EQ(2, ::std::get<0>(tuple));
+    EXPECT_EQ("xx", ::std::get<2>(tuple));
+
+    ::std::array<int, 4> arr{{ 1, 2, 3, 4 }};
+    int sum = 0;
+    for_each(arr, [&](int v) { sum += v; });
+    EXPECT_EQ(10, sum);
+}
+
+TEST(StaticFor, Unroll)
+{
+    ::std::vector<::std::size_t> indexes;
+    auto collect = [&](::std::size_t i) { indexes.push_back(i); };
+    unroll<3>(collect);
+    EXPECT_EQ((::std::vector<::std::size_t>{ 0, 1, 2 }), indexes);
+
+    indexes.clear();
+    unroll<11, 4>(collect);
+    ASSERT_EQ(11ul, indexes.size());
+    for (::std::size_t i = 0; i < indexes.size(); ++i)
+        EXPECT_EQ(i, indexes[i]);
+
+    indexes.clear();
+    unroll<8, 4>(collect);
+    EXPECT_EQ(8ul, indexes.size());
+    unroll<0>(collect);
+    EXPECT_EQ(8ul, indexes.size());
+}
+
 TEST(Dummy, AllIsDoneStatically)
 {
 }
@@ -0,0 +1,98 @@
+/*
+ * table_tests.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: zmij
+ */
+
+#include <gtest/gtest.h>
+#include <pushkin/meta/table.hpp>
+#include <pushkin/util/crc32.hpp>
+#include <pushkin/util/hex.hpp>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace psst {
+namespace util {
+namespace test {
+
+namespace {
+
+struct square {
+    constexpr ::std::size_t
+    operator()(::std::size_t i) const noexcept
+    { return i * i; }
+};
+
+struct multiply {
+    constexpr int
+    operator()(::std::size_t i, ::std::size_t j) const noexcept
+    { return static_cast<int>(i * j); }
+};
+
+::std::uint32_t
+bitwise_crc32c(void const* data, ::std::size_t size, ::std::uint32_t crc = 0)
+{
+    auto p = static_cast<unsigned char const*>(data);
+    crc = ~crc;
+    for (::std::size_t i = 0; i < size; ++i) {
+        crc ^= p[i];
+        for (auto b = 0; b < 8; ++b)
+            crc = (crc & 1) ? (crc >> 1) ^ crc32c_polynomial : crc >> 1;
+    }
+    return ~crc;
+}
+
+}  /* namespace  */
+
+constexpr auto squares = meta::make_table<10, square>();
+static_assert(squares.size() == 10, "");
+static_assert(squares[0] == 0 && squares[9] == 81, "");
+static_assert(meta::table_v<300, square>[299] == 299 * 299, "");
+
+constexpr auto products = meta::make_table<4, 3, multiply>();
+static_assert(products.size() == 4 && products[0].size() == 3, "");
+static_assert(products[3][2] == 6, "");
+static_assert(meta::table_2d_v<4, 3, multiply>[2][1] == 2, "");
+
+TEST(Crc32, CheckValues)
+{
+    char const check[] = "123456789";
+    EXPECT_EQ(0xe3069283u, crc32c(check, 9));
+    EXPECT_EQ(0xcbf43926u, crc32<crc32_ieee_polynomial>(check, 9));
+    EXPECT_EQ(0u, crc32c(check, 0));
+    EXPECT_EQ(0xf26b8303u, crc32_tables<crc32c_polynomial>()[0][1]);
+}
+
+TEST(Crc32, SlicingMatchesBitwise)
+{
+    ::std::vector<unsigned char> data(1031);
+    for (::std::size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<unsigned char>(i * 131 + 7);
+    for (::std::size_t offset = 0; offset < 8; ++offset) {
+        for (auto size : { 0ul, 1ul, 7ul, 8ul, 9ul, 100ul, 1000ul }) {
+            EXPECT_EQ(bitwise_crc32c(data.data() + offset, size),
+                    crc32c(data.data() + offset, size)) << offset << " " << size;
+        }
+    }
+    // Continue a calculation
+    auto first = crc32c(data.data(), 500);
+    EXPECT_EQ(crc32c(data.data(), data.size()),
+            crc32c(data.data() + 500, data.size() - 500, first));
+}
+
+TEST(Hex, ToHex)
+{
+    EXPECT_EQ('f', hex_pairs()[0xf0][0]);
+    EXPECT_EQ('0', hex_pairs()[0xf0][1]);
+    unsigned char const bytes[]{ 0x00, 0x01, 0x7f, 0x80, 0xab, 0xff };
+    char out[sizeof(bytes) * 2];
+    EXPECT_EQ(out + sizeof(out), to_hex(bytes, sizeof(bytes), out));
+    EXPECT_EQ("00017f80abff", ::std::string(out, sizeof(out)));
+}
+
+}  /* namespace test */
+}  /* namespace util */
+}  /* namespace psst */